@@ -133,6 +133,7 @@ enum options_client {
   OPT_SLAP_COMMIT,
   OPT_SLAP_DETACH,
   OPT_SLAP_NO_DROP,
+  OPT_SLAP_LATENCY_PERCENTILES,
   OPT_MYSQL_REPLACE_INTO,
   OPT_BASE64_OUTPUT_MODE,
   OPT_SERVER_ID,
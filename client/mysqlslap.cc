@@ -106,6 +106,7 @@ TODO:
 #endif
 #include <stdio.h>
 #include <time.h>
+#include <chrono>
 
 #include "client/client_priv.h"
 #include "compression.h"
@@ -144,6 +145,19 @@ native_cond_t sleep_threshold;
 char **primary_keys;
 unsigned long long primary_keys_number_of;
 
+/*
+  Per query latency histogram, in microseconds. Values below
+  LATENCY_SUB_BUCKETS get a bucket each; above that every power of two is
+  split into LATENCY_SUB_BUCKETS linear buckets, which bounds the relative
+  error of a reported percentile to 1/LATENCY_SUB_BUCKETS. Each client
+  thread fills its own histogram and adds it to latency_histogram under
+  counter_mutex when it ends.
+*/
+#define LATENCY_SUB_BUCKET_BITS 4
+#define LATENCY_SUB_BUCKETS (1U << LATENCY_SUB_BUCKET_BITS)
+#define LATENCY_BUCKETS ((64 - LATENCY_SUB_BUCKET_BITS + 1) * LATENCY_SUB_BUCKETS)
+static ulonglong latency_histogram[LATENCY_BUCKETS];
+
 static char *host = nullptr, *user_supplied_query = nullptr,
             *user_supplied_pre_statements = nullptr,
             *user_supplied_post_statements = nullptr, *default_engine = nullptr,
@@ -161,6 +175,7 @@ const char *create_schema_string = "mysqlslap";
 static bool opt_preserve = true, opt_no_drop = false;
 static bool debug_info_flag = false, debug_check_flag = false;
 static bool opt_only_print = false;
+static bool opt_latency_percentiles = false;
 static bool opt_compress = false, opt_silent = false,
             auto_generate_sql_autoincrement = false,
             auto_generate_sql_guid_primary = false, auto_generate_sql = false;
@@ -268,6 +283,7 @@ static statement *create_statements = nullptr, *query_statements = nullptr;
 
 /* Prototypes */
 void print_conclusions(conclusions *con);
+void print_latency_percentiles();
 void print_conclusions_csv(conclusions *con);
 void generate_stats(conclusions *con, option_string *eng, stats *sptr);
 uint parse_comma(const char *string, uint **range);
@@ -469,6 +485,7 @@ void concurrency_loop(MYSQL *mysql, uint current, option_string *eptr) {
                          MYF(MY_ZEROFILL | MY_FAE | MY_WME));
 
   memset(&conclusion, 0, sizeof(conclusions));
+  memset(latency_histogram, 0, sizeof(latency_histogram));
 
   if (auto_actual_queries)
     client_limit = auto_actual_queries;
@@ -531,7 +548,10 @@ void concurrency_loop(MYSQL *mysql, uint current, option_string *eptr) {
 
   generate_stats(&conclusion, eptr, head_sptr);
 
-  if (!opt_silent) print_conclusions(&conclusion);
+  if (!opt_silent) {
+    print_conclusions(&conclusion);
+    if (opt_latency_percentiles) print_latency_percentiles();
+  }
   if (opt_csv_str) print_conclusions_csv(&conclusion);
 
   my_free(head_sptr);
@@ -644,6 +664,10 @@ static struct my_option my_long_options[] = {
     {"iterations", 'i', "Number of times to run the tests.", &iterations,
      &iterations, nullptr, GET_UINT, REQUIRED_ARG, 1, 1, UINT_MAX, nullptr, 0,
      nullptr},
+    {"latency-percentiles", OPT_SLAP_LATENCY_PERCENTILES,
+     "Measure the latency of each query and report its percentiles.",
+     &opt_latency_percentiles, &opt_latency_percentiles, nullptr, GET_BOOL,
+     NO_ARG, 0, 0, 0, nullptr, 0, nullptr},
     {"no-drop", OPT_SLAP_NO_DROP, "Do not drop the schema after the test.",
      &opt_no_drop, &opt_no_drop, nullptr, GET_BOOL, NO_ARG, 0, 0, 0, nullptr, 0,
      nullptr},
@@ -1672,6 +1696,23 @@ static int run_scheduler(stats *sptr, statement *stmts, uint concur,
   return 0;
 }
 
+static uint latency_bucket(ulonglong usec) {
+  if (usec < LATENCY_SUB_BUCKETS) return (uint)usec;
+  uint msb = 63;
+  while (!(usec >> msb)) msb--;
+  const uint shift = msb - LATENCY_SUB_BUCKET_BITS;
+  return (shift + 1) * LATENCY_SUB_BUCKETS +
+         (uint)((usec >> shift) & (LATENCY_SUB_BUCKETS - 1));
+}
+
+/* Lowest latency, in microseconds, that falls into the given bucket. */
+static ulonglong latency_bucket_value(uint bucket) {
+  if (bucket < LATENCY_SUB_BUCKETS) return bucket;
+  const uint shift = bucket / LATENCY_SUB_BUCKETS - 1;
+  return (ulonglong)(LATENCY_SUB_BUCKETS + bucket % LATENCY_SUB_BUCKETS)
+         << shift;
+}
+
 extern "C" void *run_task(void *p) {
   ulonglong queries;
   ulonglong detach_counter;
@@ -1680,6 +1721,8 @@ extern "C" void *run_task(void *p) {
   MYSQL_RES *result;
   statement *ptr;
   thread_context *con = (thread_context *)p;
+  ulonglong *latencies = nullptr;
+  std::chrono::steady_clock::time_point query_start;
 
   {
     DBUG_TRACE;
@@ -1715,6 +1758,11 @@ extern "C" void *run_task(void *p) {
     if (verbose >= 3) printf("connected!\n");
     queries = 0;
 
+    if (opt_latency_percentiles)
+      latencies = (ulonglong *)my_malloc(
+          PSI_NOT_INSTRUMENTED, sizeof(latency_histogram),
+          MYF(MY_ZEROFILL | MY_FAE | MY_WME));
+
     commit_counter = 0;
     if (commit_rate)
       run_query(mysql, "SET AUTOCOMMIT=0", strlen("SET AUTOCOMMIT=0"));
@@ -1734,6 +1782,8 @@ extern "C" void *run_task(void *p) {
         if (slap_connect(mysql)) goto end;
       }
 
+      if (latencies) query_start = std::chrono::steady_clock::now();
+
       /*
         We have to execute differently based on query type. This should become a
         function.
@@ -1790,6 +1840,13 @@ extern "C" void *run_task(void *p) {
       } while (mysql_next_result(mysql) == 0);
       queries++;
 
+      if (latencies) {
+        const auto usec = std::chrono::duration_cast<std::chrono::microseconds>(
+                              std::chrono::steady_clock::now() - query_start)
+                              .count();
+        latencies[latency_bucket((ulonglong)usec)]++;
+      }
+
       if (commit_rate && (++commit_counter == commit_rate)) {
         commit_counter = 0;
         run_query(mysql, "COMMIT", strlen("COMMIT"));
@@ -1808,9 +1865,14 @@ extern "C" void *run_task(void *p) {
     mysql_thread_end();
 
     native_mutex_lock(&counter_mutex);
+    if (latencies) {
+      for (uint x = 0; x < LATENCY_BUCKETS; x++)
+        latency_histogram[x] += latencies[x];
+    }
     thread_counter--;
     native_cond_signal(&count_threshold);
     native_mutex_unlock(&counter_mutex);
+    my_free(latencies);
   }
   my_thread_exit(nullptr);
   return nullptr;
@@ -1975,6 +2037,40 @@ void print_conclusions(conclusions *con) {
   printf("\n");
 }
 
+void print_latency_percentiles() {
+  static const struct {
+    const char *name;
+    double fraction;
+  } percentiles[] = {
+      {"50", 0.5}, {"90", 0.9}, {"99", 0.99}, {"99.9", 0.999}};
+  ulonglong total = 0;
+  uint x;
+
+  for (x = 0; x < LATENCY_BUCKETS; x++) total += latency_histogram[x];
+  if (!total) return;
+
+  printf("Query latency\n");
+  for (const auto &percentile : percentiles) {
+    /* Number of queries at or below the percentile, rounded up. */
+    const ulonglong rank = (ulonglong)(percentile.fraction * (total - 1)) + 1;
+    ulonglong seen = 0;
+    for (x = 0; x < LATENCY_BUCKETS; x++) {
+      seen += latency_histogram[x];
+      if (seen >= rank) break;
+    }
+    const ulonglong usec = latency_bucket_value(x);
+    printf("\t%s percentile: %llu.%03llu milliseconds\n", percentile.name,
+           usec / 1000, usec % 1000);
+  }
+  for (x = LATENCY_BUCKETS; x > 0 && !latency_histogram[x - 1]; x--) {
+  }
+  const ulonglong max_usec = latency_bucket_value(x - 1);
+  printf("\tMaximum: %llu.%03llu milliseconds\n", max_usec / 1000,
+         max_usec % 1000);
+  printf("\tNumber of queries measured: %llu\n", total);
+  printf("\n");
+}
+
 void print_conclusions_csv(conclusions *con) {
   char buffer[HUGE_STRING_LENGTH];
   const char *ptr = auto_generate_sql_type ? auto_generate_sql_type : "query";
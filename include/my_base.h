@@ -1123,6 +1123,13 @@ enum key_range_flags {
     backward. @see quick_range_seq_init, get_quick_keys.
   */
   DESC_FLAG = 1 << 10,
+  /*
+    Used together with EQ_RANGE when index statistics are used for the
+    other equality ranges of the index: an index dive is done for this
+    range and its result is used to extrapolate the estimate of the
+    ranges flagged with SKIP_RECORDS_IN_RANGE.
+  */
+  SAMPLED_DIVE_RANGE = 1 << 11,
 };
 
 struct key_range {
@@ -837,6 +837,11 @@ extern bool my_uncompress(mysql_compress_context *, uchar *, size_t, size_t *);
 extern uchar *my_compress_alloc(mysql_compress_context *comp_ctx,
                                 const uchar *packet, size_t *len,
                                 size_t *complen);
+extern size_t my_compress_bound(const mysql_compress_context *comp_ctx,
+                                size_t len);
+extern size_t my_compress_into(mysql_compress_context *comp_ctx,
+                               const uchar *packet, size_t len, uchar *dst,
+                               size_t dst_len);
 
 extern uint my_set_max_open_files(uint files);
 
@@ -147,6 +147,46 @@ int my_create_key(unsigned char *rkey, const unsigned char *key,
   return 0;
 }
 
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
+namespace {
+/**
+  A cipher context cached per thread. Callers such as InnoDB encrypt many
+  small buffers (pages), with the cached context a call does not allocate
+  a new one. The context is reset after every call, so that no key material
+  is left in it.
+*/
+class Aes_thread_ctx {
+ public:
+  ~Aes_thread_ctx() { EVP_CIPHER_CTX_free(m_ctx); }
+
+  /** @return the context of this thread, or nullptr on failure */
+  EVP_CIPHER_CTX *get() {
+    if (m_ctx == nullptr) m_ctx = EVP_CIPHER_CTX_new();
+    return m_ctx;
+  }
+
+ private:
+  EVP_CIPHER_CTX *m_ctx{nullptr};
+};
+
+thread_local Aes_thread_ctx aes_thread_ctx;
+}  // namespace
+#endif /* OPENSSL_VERSION_NUMBER >= 0x10100000L */
+
+/**
+  Clear a cipher context after use.
+
+  @param ctx context to clear, may be nullptr
+*/
+static void my_aes_ctx_release(EVP_CIPHER_CTX *ctx) {
+  if (ctx == nullptr) return;
+#if OPENSSL_VERSION_NUMBER < 0x10100000L
+  EVP_CIPHER_CTX_cleanup(ctx);
+#else  /* OPENSSL_VERSION_NUMBER < 0x10100000L */
+  EVP_CIPHER_CTX_reset(ctx);
+#endif /* OPENSSL_VERSION_NUMBER < 0x10100000L */
+}
+
 int my_aes_encrypt(const unsigned char *source, uint32 source_length,
                    unsigned char *dest, const unsigned char *key,
                    uint32 key_length, enum my_aes_opmode mode,
@@ -156,7 +196,7 @@ int my_aes_encrypt(const unsigned char *source, uint32 source_length,
   EVP_CIPHER_CTX stack_ctx;
   EVP_CIPHER_CTX *ctx = &stack_ctx;
 #else  /* OPENSSL_VERSION_NUMBER < 0x10100000L */
-  EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
+  EVP_CIPHER_CTX *ctx = aes_thread_ctx.get();
 #endif /* OPENSSL_VERSION_NUMBER < 0x10100000L */
   const EVP_CIPHER *cipher = aes_evp_type(mode);
   int u_len, f_len;
@@ -176,21 +216,13 @@ int my_aes_encrypt(const unsigned char *source, uint32 source_length,
 
   if (!EVP_EncryptFinal(ctx, dest + u_len, &f_len)) goto aes_error; /* Error */
 
-#if OPENSSL_VERSION_NUMBER < 0x10100000L
-  EVP_CIPHER_CTX_cleanup(ctx);
-#else  /* OPENSSL_VERSION_NUMBER < 0x10100000L */
-  EVP_CIPHER_CTX_free(ctx);
-#endif /* OPENSSL_VERSION_NUMBER < 0x10100000L */
+  my_aes_ctx_release(ctx);
   return u_len + f_len;
 
 aes_error:
   /* need to explicitly clean up the error if we want to ignore it */
   ERR_clear_error();
-#if OPENSSL_VERSION_NUMBER < 0x10100000L
-  EVP_CIPHER_CTX_cleanup(ctx);
-#else  /* OPENSSL_VERSION_NUMBER < 0x10100000L */
-  EVP_CIPHER_CTX_free(ctx);
-#endif /* OPENSSL_VERSION_NUMBER < 0x10100000L */
+  my_aes_ctx_release(ctx);
   return MY_AES_BAD_DATA;
 }
 
@@ -203,7 +235,7 @@ int my_aes_decrypt(const unsigned char *source, uint32 source_length,
   EVP_CIPHER_CTX stack_ctx;
   EVP_CIPHER_CTX *ctx = &stack_ctx;
 #else  /* OPENSSL_VERSION_NUMBER < 0x10100000L */
-  EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
+  EVP_CIPHER_CTX *ctx = aes_thread_ctx.get();
 #endif /* OPENSSL_VERSION_NUMBER < 0x10100000L */
   const EVP_CIPHER *cipher = aes_evp_type(mode);
   int u_len, f_len;
@@ -226,22 +258,14 @@ int my_aes_decrypt(const unsigned char *source, uint32 source_length,
   if (!EVP_DecryptFinal_ex(ctx, dest + u_len, &f_len))
     goto aes_error; /* Error */
 
-#if OPENSSL_VERSION_NUMBER < 0x10100000L
-  EVP_CIPHER_CTX_cleanup(ctx);
-#else  /* OPENSSL_VERSION_NUMBER < 0x10100000L */
-  EVP_CIPHER_CTX_free(ctx);
-#endif /* OPENSSL_VERSION_NUMBER < 0x10100000L */
+  my_aes_ctx_release(ctx);
 
   return u_len + f_len;
 
 aes_error:
   /* need to explicitly clean up the error if we want to ignore it */
   ERR_clear_error();
-#if OPENSSL_VERSION_NUMBER < 0x10100000L
-  EVP_CIPHER_CTX_cleanup(ctx);
-#else  /* OPENSSL_VERSION_NUMBER < 0x10100000L */
-  EVP_CIPHER_CTX_free(ctx);
-#endif /* OPENSSL_VERSION_NUMBER < 0x10100000L */
+  my_aes_ctx_release(ctx);
   return MY_AES_BAD_DATA;
 }
 
@@ -307,6 +307,81 @@ uchar *my_compress_alloc(mysql_compress_context *comp_ctx, const uchar *packet,
   return zlib_compress_alloc(&comp_ctx->u.zlib_ctx, packet, len, complen);
 }
 
+/**
+  Get the size of a buffer that my_compress_into() can always compress
+  'len' bytes into.
+
+  @param comp_ctx  Pointer to compression context.
+  @param len       Length of the data to compress.
+
+  @return the worst case compressed length.
+*/
+
+size_t my_compress_bound(const mysql_compress_context *comp_ctx, size_t len) {
+  if (comp_ctx->algorithm == enum_compression_algorithm::MYSQL_ZSTD)
+    return ZSTD_compressBound(len);
+  if (comp_ctx->algorithm == enum_compression_algorithm::MYSQL_ZLIB)
+    return compressBound(static_cast<uLong>(len));
+  return len;
+}
+
+/**
+  Compress a packet into a buffer provided by the caller. Unlike
+  my_compress(), neither a temporary buffer nor a copy of the data is
+  needed.
+
+  @param comp_ctx  Pointer to compression context.
+  @param packet    Data to compress.
+  @param len       Length of data to compress at 'packet'.
+  @param dst       Where to store the compressed data.
+  @param dst_len   Size of 'dst', at least my_compress_bound(comp_ctx, len).
+
+  @return length of the compressed data at 'dst', or 0 if the packet should
+  be sent uncompressed: it is too short, it did not get shorter, or
+  compression failed.
+*/
+
+size_t my_compress_into(mysql_compress_context *comp_ctx, const uchar *packet,
+                        size_t len, uchar *dst, size_t dst_len) {
+  DBUG_TRACE;
+  if (len < MIN_COMPRESS_LENGTH) {
+    DBUG_PRINT("note", ("Packet too short: Not compressed"));
+    return 0;
+  }
+
+  size_t complen = 0;
+  if (comp_ctx->algorithm == enum_compression_algorithm::MYSQL_ZSTD) {
+    mysql_zstd_compress_context *zstd_ctx = &comp_ctx->u.zstd_ctx;
+    if (zstd_ctx->cctx == nullptr &&
+        !(zstd_ctx->cctx = ZSTD_createCCtx())) {
+      return 0;
+    }
+    const size_t zstd_res =
+        ZSTD_compressCCtx(zstd_ctx->cctx, dst, dst_len, packet, len,
+                          zstd_ctx->compression_level);
+    if (ZSTD_isError(zstd_res)) {
+      DBUG_PRINT("error", ("Can't compress zstd packet, error: %zd, %s",
+                           zstd_res, ZSTD_getErrorName(zstd_res)));
+      return 0;
+    }
+    complen = zstd_res;
+  } else if (comp_ctx->algorithm == enum_compression_algorithm::MYSQL_ZLIB) {
+    uLongf tmp_complen = static_cast<uLongf>(dst_len);
+    if (compress2(dst, &tmp_complen, packet, static_cast<uLong>(len),
+                  comp_ctx->u.zlib_ctx.compression_level) != Z_OK)
+      return 0;
+    complen = tmp_complen;
+  } else {
+    return 0;
+  }
+
+  if (complen >= len) {
+    DBUG_PRINT("note", ("Packet got longer on compression; Not compressed"));
+    return 0;
+  }
+  return complen;
+}
+
 /**
   Uncompress packet
 
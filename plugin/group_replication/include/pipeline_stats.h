@@ -678,6 +678,12 @@ class Flow_control_module {
   std::atomic<int64> m_quota_used;
   std::atomic<int64> m_quota_size;
 
+  /*
+    Capacity estimate carried between flow control steps when
+    flow_control_capacity_smoothing_percent is set, 0 when there is none.
+  */
+  int64 m_smoothed_capacity;
+
   /*
     Seconds spent in flow control
   */
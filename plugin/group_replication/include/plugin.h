@@ -253,6 +253,7 @@ int get_flow_control_member_quota_percent_var();
 int get_flow_control_period_var();
 int get_flow_control_hold_percent_var();
 int get_flow_control_release_percent_var();
+int get_flow_control_capacity_smoothing_percent_var();
 ulong get_components_stop_timeout_var();
 ulong get_communication_stack_var();
 
@@ -294,6 +294,7 @@ struct plugin_options_variables {
   int flow_control_period_var;
   int flow_control_hold_percent_var;
   int flow_control_release_percent_var;
+  int flow_control_capacity_smoothing_percent_var;
 
   ulonglong clone_threshold_var;
 
@@ -721,6 +721,7 @@ Flow_control_module::Flow_control_module()
     : m_holds_in_period(0),
       m_quota_used(0),
       m_quota_size(0),
+      m_smoothed_capacity(0),
       m_stamp(0),
       seconds_to_skip(1) {
   mysql_mutex_init(key_GR_LOCK_pipeline_stats_flow_control,
@@ -926,8 +927,26 @@ void Flow_control_module::flow_control_step(
         if (get_flow_control_min_quota_var() > 0)
           lim_throttle = get_flow_control_min_quota_var();
 
-        min_capacity =
-            std::max(std::min(min_capacity, safe_capacity), lim_throttle);
+        min_capacity = std::min(min_capacity, safe_capacity);
+
+        /*
+          Blend the capacity measured on this period with the previous
+          estimate, so that a single slow or fast period does not make the
+          quota jump.
+        */
+        int smoothing = get_flow_control_capacity_smoothing_percent_var();
+        if (smoothing == 0) {
+          m_smoothed_capacity = 0;
+        } else if (min_capacity < MAXTPS) {
+          if (m_smoothed_capacity > 0)
+            min_capacity = static_cast<int64>(
+                (static_cast<double>(m_smoothed_capacity) * smoothing +
+                 static_cast<double>(min_capacity) * (100 - smoothing)) /
+                100.0);
+          m_smoothed_capacity = min_capacity;
+        }
+
+        min_capacity = std::max(min_capacity, lim_throttle);
         quota_size = static_cast<int64>(min_capacity * HOLD_FACTOR);
 
         if (max_quota > 0) quota_size = std::min(quota_size, max_quota);
@@ -972,6 +991,7 @@ void Flow_control_module::flow_control_step(
     case FCM_DISABLED:
       m_quota_size.store(0);
       m_quota_used.store(0);
+      m_smoothed_capacity = 0;
       break;
 
     default:
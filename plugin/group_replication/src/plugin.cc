@@ -350,6 +350,10 @@ int get_flow_control_release_percent_var() {
   return ov.flow_control_release_percent_var;
 }
 
+int get_flow_control_capacity_smoothing_percent_var() {
+  return ov.flow_control_capacity_smoothing_percent_var;
+}
+
 ulong get_components_stop_timeout_var() {
   return ov.components_stop_timeout_var;
 }
@@ -5108,6 +5112,22 @@ static MYSQL_SYSVAR_INT(
     0        /* block */
 );
 
+static MYSQL_SYSVAR_INT(
+    flow_control_capacity_smoothing_percent,               /* name */
+    ov.flow_control_capacity_smoothing_percent_var,        /* var */
+    PLUGIN_VAR_OPCMDARG | PLUGIN_VAR_PERSIST_AS_READ_ONLY, /* optional var */
+    "Specifies the weight, as a percentage, that the capacity estimated on "
+    "previous flow-control iterations keeps when computing the quota, so "
+    "that it follows the members' apply rate smoothly instead of "
+    "oscillating. Default: 0%, 0 disables",
+    nullptr, /* check func. */
+    nullptr, /* update func. */
+    0,       /* default */
+    0,       /* min */
+    99,      /* max */
+    0        /* block */
+);
+
 static MYSQL_SYSVAR_ULONGLONG(
     clone_threshold,                                       /* name */
     ov.clone_threshold_var,                                /* var */
@@ -5400,6 +5420,7 @@ static SYS_VAR *group_replication_system_vars[] = {
     MYSQL_SYSVAR(flow_control_period),
     MYSQL_SYSVAR(flow_control_hold_percent),
     MYSQL_SYSVAR(flow_control_release_percent),
+    MYSQL_SYSVAR(flow_control_capacity_smoothing_percent),
     MYSQL_SYSVAR(member_expel_timeout),
     MYSQL_SYSVAR(message_cache_size),
     MYSQL_SYSVAR(clone_threshold),
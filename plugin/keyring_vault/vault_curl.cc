@@ -52,17 +52,6 @@ namespace keyring {
 
 static const std::size_t max_response_size = 32000000;
 
-class Curl_session_guard : private boost::noncopyable {
- public:
-  Curl_session_guard(CURL *curl) noexcept : curl(curl) {}
-  ~Curl_session_guard() {
-    if (curl != nullptr) curl_easy_cleanup(curl);
-  }
-
- private:
-  CURL *curl;
-};
-
 static size_t write_response_memory(void *contents, size_t size, size_t nmemb,
                                     void *userp) noexcept {
   size_t realsize = size * nmemb;
@@ -239,17 +228,30 @@ bool Vault_curl::setup_curl_session(CURL *curl) {
   return false;
 }
 
+CURL *Vault_curl::get_curl_session() {
+  /*
+    Reusing the handle keeps its connection cache, so consecutive requests
+    to Vault do not each pay for a new TCP connection and TLS handshake.
+    curl_easy_reset() only drops the options set for the previous request.
+  */
+  if (curl_session_ == nullptr)
+    curl_session_ = curl_easy_init();
+  else
+    curl_easy_reset(curl_session_);
+  return curl_session_;
+}
+
 bool Vault_curl::list_keys(Secure_string *response) {
   Secure_string url_to_list = get_secret_url_metadata() + "?list=true";
   CURLcode curl_res = CURLE_OK;
   long http_code = 0;
 
-  CURL *curl = curl_easy_init();
+  std::lock_guard<std::mutex> curl_session_lock(curl_session_mutex_);
+  CURL *curl = get_curl_session();
   if (curl == nullptr) {
     logger_->log(MY_ERROR_LEVEL, "Cannot initialize curl session");
     return true;
   }
-  Curl_session_guard curl_session_guard(curl);
 
   if (setup_curl_session(curl) ||
       (curl_res = curl_easy_setopt(curl, CURLOPT_URL, url_to_list.c_str())) !=
@@ -297,12 +299,12 @@ bool Vault_curl::probe_mount_point_config(const Secure_string &partial_path,
   CURLcode curl_res = CURLE_OK;
   long http_code = 0;
 
-  CURL *curl = curl_easy_init();
+  std::lock_guard<std::mutex> curl_session_lock(curl_session_mutex_);
+  CURL *curl = get_curl_session();
   if (curl == nullptr) {
     logger_->log(MY_ERROR_LEVEL, "Cannot initialize curl session");
     return true;
   }
-  Curl_session_guard curl_session_guard(curl);
 
   if (setup_curl_session(curl) ||
       (curl_res = curl_easy_setopt(curl, CURLOPT_URL, config_url.c_str())) !=
@@ -334,12 +336,12 @@ bool Vault_curl::write_key(const Vault_key &key, Secure_string *response) {
   Secure_string key_url;
   if (get_key_url(key, &key_url)) return true;
 
-  CURL *curl = curl_easy_init();
+  std::lock_guard<std::mutex> curl_session_lock(curl_session_mutex_);
+  CURL *curl = get_curl_session();
   if (curl == nullptr) {
     logger_->log(MY_ERROR_LEVEL, "Cannot initialize curl session");
     return true;
   }
-  Curl_session_guard curl_session_guard(curl);
 
   if (setup_curl_session(curl) ||
       (curl_res = curl_easy_setopt(curl, CURLOPT_URL, key_url.c_str())) !=
@@ -359,12 +361,12 @@ bool Vault_curl::read_key(const Vault_key &key, Secure_string *response) {
   if (get_key_url(key, &key_url)) return true;
   CURLcode curl_res = CURLE_OK;
 
-  CURL *curl = curl_easy_init();
+  std::lock_guard<std::mutex> curl_session_lock(curl_session_mutex_);
+  CURL *curl = get_curl_session();
   if (curl == nullptr) {
     logger_->log(MY_ERROR_LEVEL, "Cannot initialize curl session");
     return true;
   }
-  Curl_session_guard curl_session_guard(curl);
 
   if (setup_curl_session(curl) ||
       (curl_res = curl_easy_setopt(curl, CURLOPT_URL, key_url.c_str())) !=
@@ -382,12 +384,12 @@ bool Vault_curl::delete_key(const Vault_key &key, Secure_string *response) {
   if (get_key_url(key, &key_url)) return true;
   CURLcode curl_res = CURLE_OK;
 
-  CURL *curl = curl_easy_init();
+  std::lock_guard<std::mutex> curl_session_lock(curl_session_mutex_);
+  CURL *curl = get_curl_session();
   if (curl == nullptr) {
     logger_->log(MY_ERROR_LEVEL, "Cannot initialize curl session");
     return true;
   }
-  Curl_session_guard curl_session_guard(curl);
 
   if (setup_curl_session(curl) ||
       (curl_res = curl_easy_setopt(curl, CURLOPT_URL, key_url.c_str())) !=
@@ -20,6 +20,7 @@
 
 #include <curl/curl.h>
 #include <boost/core/noncopyable.hpp>
+#include <mutex>
 #include <sstream>
 #include "i_vault_curl.h"
 #include "plugin/keyring/common/i_keyring_key.h"
@@ -38,6 +39,7 @@ class Vault_curl final : public IVault_curl, private boost::noncopyable {
       : logger_(logger),
         parser_(parser),
         list(nullptr),
+        curl_session_(nullptr),
         timeout(timeout),
         vault_credentials_(),
         mount_point_path_(),
@@ -46,6 +48,7 @@ class Vault_curl final : public IVault_curl, private boost::noncopyable {
 
   ~Vault_curl() override {
     if (list != nullptr) curl_slist_free_all(list);
+    if (curl_session_ != nullptr) curl_easy_cleanup(curl_session_);
   }
 
   bool init(const Vault_credentials &vault_credentials) override;
@@ -67,6 +70,7 @@ class Vault_curl final : public IVault_curl, private boost::noncopyable {
   }
 
  private:
+  CURL *get_curl_session();
   bool setup_curl_session(CURL *curl);
   std::string get_error_from_curl(CURLcode curl_code);
   bool encode_key_signature(const Vault_key &key,
@@ -84,6 +88,9 @@ class Vault_curl final : public IVault_curl, private boost::noncopyable {
   char curl_errbuf[CURL_ERROR_SIZE];  // error from CURL
   Secure_ostringstream read_data_ss;
   struct curl_slist *list;
+  // Handle reused by all requests, serialized by curl_session_mutex_
+  CURL *curl_session_;
+  std::mutex curl_session_mutex_;
   uint timeout;
 
   Vault_credentials vault_credentials_;
@@ -64,6 +64,12 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
   procfs_files_spec must be opened, read, held in memory, and finally returned
   to the client.
 
+  Expanding procfs_files_spec into the list of matching files walks every
+  directory named by its patterns.  When the view is polled frequently, the
+  global variable procfs_files_list_cache_time (in seconds, 0 by default) lets
+  queries reuse the list expanded by a previous query for that long.  The
+  contents of the files are always read at query time.
+
   Some basic metrics are provided by status variables:
 
   Name                        Description
@@ -101,7 +107,9 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA
 #include <stdlib.h>
 #include <time.h>
 
+#include <chrono>
 #include <fstream>
+#include <mutex>
 
 // MySQL 8.0 logger service interface
 static SERVICE_TYPE(registry) *reg_srv = nullptr;
@@ -139,6 +147,13 @@ static const constexpr int PROC_NAME_LEN = sizeof(PROC_NAME) - 1;
 
 static char *files_spec = nullptr;
 static char *buffer = nullptr;
+static uint files_list_cache_time = 0;
+
+/* Expanded procfs_files_spec kept for procfs_files_list_cache_time. */
+static std::mutex files_list_mutex;
+static std::vector<std::string> cached_files;
+static bool cached_files_valid = false;
+static std::chrono::steady_clock::time_point cached_files_time;
 
 static struct st_mysql_information_schema view = {
     MYSQL_INFORMATION_SCHEMA_INTERFACE_VERSION};
@@ -158,7 +173,15 @@ static MYSQL_SYSVAR_STR(files_spec, files_spec,
                         "with ACCESS_PROCFS privilege.",
                         nullptr, nullptr, DEFAULT_FILES_SPEC);
 
-static SYS_VAR *system_variables[] = {MYSQL_SYSVAR(files_spec), nullptr};
+static MYSQL_SYSVAR_UINT(files_list_cache_time, files_list_cache_time,
+                         PLUGIN_VAR_RQCMDARG,
+                         "Number of seconds for which the list of files "
+                         "matching procfs_files_spec is reused by queries "
+                         "instead of being expanded again. 0 disables it.",
+                         nullptr, nullptr, 0, 0, 3600, 0);
+
+static SYS_VAR *system_variables[] = {
+    MYSQL_SYSVAR(files_spec), MYSQL_SYSVAR(files_list_cache_time), nullptr};
 
 static std::atomic<uint64_t> access_violations(0);
 static std::atomic<uint64_t> queries(0);
@@ -363,6 +386,24 @@ static void fill_files_list(std::vector<std::string> &files) {
   }
 }
 
+static void get_files_list(std::vector<std::string> &files) {
+  const uint cache_time = files_list_cache_time;
+  if (cache_time == 0) {
+    fill_files_list(files);
+    return;
+  }
+
+  const auto now = std::chrono::steady_clock::now();
+  std::lock_guard<std::mutex> guard(files_list_mutex);
+  if (!cached_files_valid ||
+      now - cached_files_time >= std::chrono::seconds(cache_time)) {
+    fill_files_list(cached_files);
+    cached_files_time = now;
+    cached_files_valid = true;
+  }
+  files = cached_files;
+}
+
 static void fill_view_row(THD *thd, TABLE *table, const char *fname, char *buf,
                           size_t sz) {
   if (sz == 0) return;
@@ -404,7 +445,7 @@ static int fill_view(THD *thd, Table_ref *tables, Item *cond) {
   }
 
   std::vector<std::string> files;
-  fill_files_list(files);
+  get_files_list(files);
   for (std::vector<std::string>::const_iterator fname = files.begin();
        fname != files.end(); ++fname) {
     if (cond != 0 && in_args.size() > 0 &&
@@ -494,6 +535,9 @@ static int view_deinit(void *) {
 
   my_free(buffer);
 
+  cached_files.clear();
+  cached_files_valid = false;
+
   deinit_logging_service_for_plugin(&reg_srv, &log_bi, &log_bs);
 
   return 0;
@@ -24,7 +24,8 @@
 #include "plugin/semisync/semisync.h"
 #include "mysql/components/services/component_sys_var_service.h"
 
-const unsigned char ReplSemiSyncBase::kPacketMagicNum = 0xef;
+const unsigned char ReplSemiSyncBase::kPacketMagicNum =
+    SEMISYNC_PACKET_MAGIC_NUM;
 const unsigned char ReplSemiSyncBase::kPacketFlagSync = 0x01;
 
 const unsigned long Trace::kTraceGeneral = 0x0001;
@@ -30,6 +30,7 @@
 #include "my_io.h"
 #include "my_thread.h"
 #include "mysqld_error.h"
+#include "plugin/semisync/semisync_reply.h"
 #include "sql/replication.h"
 
 struct SHOW_VAR;
@@ -88,21 +89,6 @@ class ReplSemiSyncBase : public Trace {
   static const unsigned char kPacketFlagSync;
 };
 
-/* The layout of a semisync slave reply packet:
-   1 byte for the magic num
-   8 bytes for the binlog position
-   n bytes for the binlog filename, terminated with a '\0'
-*/
-#define REPLY_MAGIC_NUM_LEN 1
-#define REPLY_BINLOG_POS_LEN 8
-#define REPLY_BINLOG_NAME_LEN (FN_REFLEN + 1)
-#define REPLY_MESSAGE_MAX_LENGTH \
-  (REPLY_MAGIC_NUM_LEN + REPLY_BINLOG_POS_LEN + REPLY_BINLOG_NAME_LEN)
-#define REPLY_MAGIC_NUM_OFFSET 0
-#define REPLY_BINLOG_POS_OFFSET (REPLY_MAGIC_NUM_OFFSET + REPLY_MAGIC_NUM_LEN)
-#define REPLY_BINLOG_NAME_OFFSET \
-  (REPLY_BINLOG_POS_OFFSET + REPLY_BINLOG_POS_LEN)
-
 /**
   Return true if the named sysvar has been defined in the server.
 
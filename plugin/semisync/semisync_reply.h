@@ -0,0 +1,95 @@
+/* Copyright (c) 2023, Oracle and/or its affiliates.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License, version 2.0,
+   as published by the Free Software Foundation.
+
+   This program is also distributed with certain software (including
+   but not limited to OpenSSL) that is licensed under separate terms,
+   as designated in a particular file or component or in included license
+   documentation.  The authors of MySQL hereby grant you an additional
+   permission to link the program and your derivative works with the
+   separately licensed software that they have included with MySQL.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License, version 2.0, for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
+
+#ifndef SEMISYNC_REPLY_H
+#define SEMISYNC_REPLY_H
+
+#include <string.h>
+
+#include "my_byteorder.h"
+#include "my_inttypes.h"
+#include "my_io.h"
+
+/* Magic number that starts every semisync packet. */
+#define SEMISYNC_PACKET_MAGIC_NUM 0xef
+
+/* The layout of a semisync slave reply packet:
+   1 byte for the magic num
+   8 bytes for the binlog position
+   n bytes for the binlog filename, terminated with a '\0'
+*/
+#define REPLY_MAGIC_NUM_LEN 1
+#define REPLY_BINLOG_POS_LEN 8
+#define REPLY_BINLOG_NAME_LEN (FN_REFLEN + 1)
+#define REPLY_MESSAGE_MAX_LENGTH \
+  (REPLY_MAGIC_NUM_LEN + REPLY_BINLOG_POS_LEN + REPLY_BINLOG_NAME_LEN)
+#define REPLY_MAGIC_NUM_OFFSET 0
+#define REPLY_BINLOG_POS_OFFSET (REPLY_MAGIC_NUM_OFFSET + REPLY_MAGIC_NUM_LEN)
+#define REPLY_BINLOG_NAME_OFFSET \
+  (REPLY_BINLOG_POS_OFFSET + REPLY_BINLOG_POS_LEN)
+
+/* Outcome of decoding a semisync slave reply packet. */
+enum class Reply_packet_status {
+  OK,
+  BAD_MAGIC_NUM,
+  TOO_SHORT,
+  NAME_TOO_LONG
+};
+
+/* It decodes a reply packet into the binlog position it acknowledges.
+ *
+ * The output parameters are written only when the whole packet is valid,
+ * so that a malformed reply never changes an acknowledgement that the caller
+ * already holds.
+ *
+ * Input:
+ *  packet        - (IN)  the reply packet
+ *  packet_len    - (IN)  length of the reply packet
+ *  log_file_name - (OUT) binlog file name, at least FN_REFLEN + 1 bytes
+ *  log_file_pos  - (OUT) binlog file position
+ *
+ * Return:
+ *  Reply_packet_status::OK on success, otherwise what is wrong with it
+ */
+inline Reply_packet_status decode_reply_packet(const uchar *packet,
+                                               ulong packet_len,
+                                               char *log_file_name,
+                                               my_off_t *log_file_pos) {
+  if (packet_len <= REPLY_MAGIC_NUM_OFFSET ||
+      packet[REPLY_MAGIC_NUM_OFFSET] != SEMISYNC_PACKET_MAGIC_NUM)
+    return Reply_packet_status::BAD_MAGIC_NUM;
+
+  if (packet_len < REPLY_BINLOG_NAME_OFFSET)
+    return Reply_packet_status::TOO_SHORT;
+
+  const ulong log_file_len = packet_len - REPLY_BINLOG_NAME_OFFSET;
+  if (log_file_len >= FN_REFLEN) return Reply_packet_status::NAME_TOO_LONG;
+
+  *log_file_pos = uint8korr(packet + REPLY_BINLOG_POS_OFFSET);
+  strncpy(log_file_name, (const char *)packet + REPLY_BINLOG_NAME_OFFSET,
+          log_file_len);
+  log_file_name[log_file_len] = 0;
+
+  return Reply_packet_status::OK;
+}
+
+#endif /* SEMISYNC_REPLY_H */
@@ -333,44 +333,46 @@ int ActiveTranx::clear_active_tranx_nodes(const char *log_file_name,
   return function_exit(kWho, 0);
 }
 
-int ReplSemiSyncMaster::reportReplyPacket(uint32 server_id, const uchar *packet,
-                                          ulong packet_len) {
-  const char *kWho = "ReplSemiSyncMaster::reportReplyPacket";
-  int result = -1;
-  char log_file_name[FN_REFLEN + 1];
-  my_off_t log_file_pos;
-  ulong log_file_len = 0;
+void ReplSemiSyncMaster::reportReplyPosition(uint32 server_id,
+                                             const char *log_file_name,
+                                             my_off_t log_file_pos) {
+  const char *kWho = "ReplSemiSyncMaster::reportReplyPosition";
 
   function_enter(kWho);
 
-  if (unlikely(packet[REPLY_MAGIC_NUM_OFFSET] !=
-               ReplSemiSyncMaster::kPacketMagicNum)) {
-    LogErr(ERROR_LEVEL, ER_SEMISYNC_REPLY_MAGIC_NO_ERROR);
-    goto l_end;
-  }
-
-  if (unlikely(packet_len < REPLY_BINLOG_NAME_OFFSET)) {
-    LogErr(ERROR_LEVEL, ER_SEMISYNC_REPLY_PKT_LENGTH_TOO_SMALL);
-    goto l_end;
-  }
-
-  log_file_pos = uint8korr(packet + REPLY_BINLOG_POS_OFFSET);
-  log_file_len = packet_len - REPLY_BINLOG_NAME_OFFSET;
-  if (unlikely(log_file_len >= FN_REFLEN)) {
-    LogErr(ERROR_LEVEL, ER_SEMISYNC_REPLY_BINLOG_FILE_TOO_LARGE);
-    goto l_end;
-  }
-  strncpy(log_file_name, (const char *)packet + REPLY_BINLOG_NAME_OFFSET,
-          log_file_len);
-  log_file_name[log_file_len] = 0;
-
   if (trace_level_ & kTraceDetail)
     LogErr(INFORMATION_LEVEL, ER_SEMISYNC_SERVER_REPLY, kWho, log_file_name,
            (ulong)log_file_pos, server_id);
 
   handleAck(server_id, log_file_name, log_file_pos);
 
-l_end:
+  function_exit(kWho);
+}
+
+int ReplSemiSyncMaster::parseReplyPacket(const uchar *packet, ulong packet_len,
+                                         char *log_file_name,
+                                         my_off_t *log_file_pos) {
+  const char *kWho = "ReplSemiSyncMaster::parseReplyPacket";
+  int result = -1;
+
+  function_enter(kWho);
+
+  switch (
+      decode_reply_packet(packet, packet_len, log_file_name, log_file_pos)) {
+    case Reply_packet_status::OK:
+      result = 0;
+      break;
+    case Reply_packet_status::BAD_MAGIC_NUM:
+      LogErr(ERROR_LEVEL, ER_SEMISYNC_REPLY_MAGIC_NO_ERROR);
+      break;
+    case Reply_packet_status::TOO_SHORT:
+      LogErr(ERROR_LEVEL, ER_SEMISYNC_REPLY_PKT_LENGTH_TOO_SMALL);
+      break;
+    case Reply_packet_status::NAME_TOO_LONG:
+      LogErr(ERROR_LEVEL, ER_SEMISYNC_REPLY_BINLOG_FILE_TOO_LARGE);
+      break;
+  }
+
   return function_exit(kWho, result);
 }
 
@@ -681,9 +681,28 @@ class ReplSemiSyncMaster : public ReplSemiSyncBase {
   /* Is the slave servered by the thread requested semi-sync */
   bool is_semi_sync_slave();
 
-  /* It parses a reply packet and call reportReplyBinlog to handle it. */
-  int reportReplyPacket(uint32 server_id, const uchar *packet,
-                        ulong packet_len);
+  /* It handles the binlog position acknowledged by a reply packet, after
+   * parseReplyPacket() extracted it. When several replies of a slave are
+   * buffered, only the last one is reported.
+   */
+  void reportReplyPosition(uint32 server_id, const char *log_file_name,
+                           my_off_t log_file_pos);
+
+  /* It parses a reply packet into the binlog position it acknowledges.
+   * A malformed packet is logged and leaves log_file_name and log_file_pos
+   * untouched, so they may hold an ack of an earlier packet.
+   *
+   * Input:
+   *  packet        - (IN)  the reply packet
+   *  packet_len    - (IN)  length of the reply packet
+   *  log_file_name - (OUT) binlog file name, at least FN_REFLEN + 1 bytes
+   *  log_file_pos  - (OUT) binlog file position
+   *
+   * Return:
+   *  0: success;  non-zero: the packet is malformed
+   */
+  int parseReplyPacket(const uchar *packet, ulong packet_len,
+                       char *log_file_name, my_off_t *log_file_pos);
 
   /* In semi-sync replication, reports up to which binlog position we have
    * received replies from the slave indicating that it already get the events
@@ -242,6 +242,8 @@ static void init_net(NET *net, unsigned char *buff, unsigned int buff_len) {
 void Ack_receiver::run() {
   NET net;
   unsigned char net_buff[REPLY_MESSAGE_MAX_LENGTH];
+  char ack_file_name[FN_REFLEN + 1];
+  my_off_t ack_file_pos = 0;
   uint i;
   Socket_listener listener;
 
@@ -304,17 +306,29 @@ void Ack_receiver::run() {
             (server_extension->compress_ctx.algorithm == MYSQL_ZLIB) ||
             (server_extension->compress_ctx.algorithm == MYSQL_ZSTD);
 
+        /*
+          A replica acknowledges increasing positions, so when several acks
+          are already buffered on its socket only the last one is handed to
+          reportReplyPosition(), taking LOCK_binlog_ once instead of once per
+          ack. A malformed reply does not change the pending ack.
+        */
+        bool has_ack = false;
         do {
           net_clear(&net, false);
 
           len = my_net_read(&net);
-          if (likely(len != packet_error))
-            repl_semisync->reportReplyPacket(slave_obj.server_id, net.read_pos,
-                                             len);
-          else if (net.last_errno == ER_NET_READ_ERROR) {
+          if (likely(len != packet_error)) {
+            if (!repl_semisync->parseReplyPacket(net.read_pos, len,
+                                                 ack_file_name, &ack_file_pos))
+              has_ack = true;
+          } else if (net.last_errno == ER_NET_READ_ERROR) {
             listener.clear_socket_info(i);
           }
         } while (net.vio->has_data(net.vio) && m_status == ST_UP);
+
+        if (has_ack)
+          repl_semisync->reportReplyPosition(slave_obj.server_id,
+                                             ack_file_name, ack_file_pos);
       }
       i++;
     }
@@ -81,9 +81,14 @@ void ConnectionContainer::disconnect_all() {
 
 void ConnectionContainer::remove_connection(
     MySQLRoutingConnectionBase *connection) {
+  // the waiter checks empty() while holding the mutex: remove and destroy the
+  // connection before releasing it, so the waiter can't see an empty
+  // container while the destructor still runs.
   std::unique_lock<std::mutex> lk(connection_removed_cond_m_);
 
-  connections_.erase(connection);
+  // destroy the connection after its bucket is unlocked.
+  auto node = connections_.extract(connection);
+  node = {};
 
   connection_removed_cond_.notify_all();
 }
@@ -55,6 +55,7 @@ class concurrent_map {
   using mapped_type = Value;
   using hash_type = Hash;
   using value_type = typename std::map<Key, Value>::value_type;
+  using node_type = typename std::map<Key, Value>::node_type;
 
   concurrent_map(unsigned num_buckets = kDefaultNumberOfBucket,
                  const Hash &hasher = Hash())
@@ -81,6 +82,13 @@ class concurrent_map {
 
   void erase(const Key &key) { get_bucket(key).erase(key); }
 
+  /**
+   * remove the entry from the map without destroying it.
+   *
+   * @returns the node holding the entry, empty if key wasn't found.
+   */
+  node_type extract(const Key &key) { return get_bucket(key).extract(key); }
+
   std::size_t size() const {
     std::size_t result{0};
     for (auto &each_bucket : buckets_) {
@@ -111,6 +119,11 @@ class concurrent_map {
       data_.erase(key);
     }
 
+    node_type extract(const Key &key) {
+      std::lock_guard<std::mutex> lock(data_mutex_);
+      return data_.extract(key);
+    }
+
     template <typename Predicate>
     void for_one(const Key &key, Predicate &p) {
       std::lock_guard<std::mutex> lock(data_mutex_);
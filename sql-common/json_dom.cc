@@ -2131,6 +2131,52 @@ get_seek_func(const Json_path_iterator &it, const Json_seek_params &params) {
   return [](Val v, It i, Param p) { return seek_end(v, i, p); };
 }
 
+/**
+  Check if a path consists only of #jpl_member and #jpl_array_cell legs.
+  Such a path matches at most one value, which #seek_single_value() can
+  find without recursion.
+*/
+static bool is_single_value_path(const Json_path_iterator &begin,
+                                 const Json_path_iterator &end) {
+  return std::all_of(begin, end, [](const Json_path_leg *leg) {
+    return leg->get_type() == jpl_member || leg->get_type() == jpl_array_cell;
+  });
+}
+
+/**
+  Find the value matched by a path for which #is_single_value_path() is
+  true, by walking down the binary value one leg at a time.
+
+  @param[in,out] value  the value to search on input, the match on output
+  @param begin          iterator to the first path leg
+  @param end            iterator just after the last path leg
+  @param auto_wrap      should auto-wrapping be used in this search?
+
+  @returns true if the path matched a value, otherwise false
+*/
+static bool seek_single_value(json_binary::Value *value,
+                              const Json_path_iterator &begin,
+                              const Json_path_iterator &end, bool auto_wrap) {
+  for (auto it = begin; it != end; ++it) {
+    const Json_path_leg *leg = *it;
+    if (leg->get_type() == jpl_member) {
+      if (!value->is_object() || value->element_count() == 0) return false;
+      const size_t pos = value->lookup_index(leg->get_member_name());
+      if (pos == value->element_count()) return false;
+      *value = value->element(pos);
+    } else if (value->is_array()) {
+      const Json_array_index idx =
+          leg->first_array_index(value->element_count());
+      if (!idx.within_bounds()) return false;
+      *value = value->element(idx.position());
+    } else if (!auto_wrap || !leg->is_autowrap()) {
+      // Possibly auto-wrap non-arrays; the value is then its own cell 0.
+      return false;
+    }
+  }
+  return true;
+}
+
 bool Json_wrapper::seek(const Json_seekable_path &path, size_t legs,
                         Json_wrapper_vector *hits, bool auto_wrap,
                         bool only_need_one) {
@@ -2163,6 +2209,17 @@ bool Json_wrapper::seek(const Json_seekable_path &path, size_t legs,
     return false;
   }
 
+  /*
+    Member chains and array cells, such as $.a.b[3].c, are by far the most
+    common paths. Walk them directly instead of going through the generic
+    recursive search.
+  */
+  if (is_single_value_path(begin, end)) {
+    json_binary::Value value = m_value;
+    if (!seek_single_value(&value, begin, end, auto_wrap)) return false;
+    return hits->emplace_back(value);
+  }
+
   return seek_no_dup_elimination(
       m_value, begin, Json_seek_params(end, hits, auto_wrap, only_need_one));
 }
@@ -1241,24 +1241,29 @@ static uchar *compress_packet(NET *net, const uchar *packet, size_t *length) {
   uchar *compr_packet;
   size_t compr_length = 0;
   const uint header_length = NET_HEADER_SIZE + COMP_HEADER_SIZE;
+  mysql_compress_context *compress_ctx = compress_context(net);
+  const size_t payload_capacity =
+      std::max(*length, my_compress_bound(compress_ctx, *length));
 
   compr_packet = (uchar *)my_malloc(key_memory_NET_compress_packet,
-                                    *length + header_length, MYF(MY_WME));
+                                    payload_capacity + header_length,
+                                    MYF(MY_WME));
 
   if (compr_packet == nullptr) return nullptr;
 
-  memcpy(compr_packet + header_length, packet, *length);
-
-  mysql_compress_context *compress_ctx = compress_context(net);
-
-  /* Compress the encapsulated packet. */
-  if (my_compress(compress_ctx, compr_packet + header_length, length,
-                  &compr_length)) {
-    /*
-      If the length of the compressed packet is larger than the
-      original packet, the original packet is sent uncompressed.
-    */
-    compr_length = 0;
+  /*
+    Compress the encapsulated packet straight into the output buffer. If
+    it is too short or the compressed packet is not smaller than the
+    original packet, the original packet is sent uncompressed.
+  */
+  const size_t packed_length =
+      my_compress_into(compress_ctx, packet, *length,
+                       compr_packet + header_length, payload_capacity);
+  if (packed_length != 0) {
+    compr_length = *length;
+    *length = packed_length;
+  } else {
+    memcpy(compr_packet + header_length, packet, *length);
   }
 
   /* Length of the compressed (original) packet. */
@@ -2045,6 +2045,10 @@ bool binlog_cache_data::compress(THD *thd) {
   // no compression enabled (ctype == NONE at this point)
   if (thd->variables.binlog_trx_compression == false) goto end;
 
+  // too small to be worth compressing
+  if (uncompressed_size < thd->variables.binlog_trx_compression_min_size)
+    goto end;
+
   // do not compress if there are incident events
   DBUG_EXECUTE_IF("binlog_compression_inject_incident", set_incident(););
   if (has_incident()) goto end;
@@ -426,6 +426,8 @@ bool filesort(THD *thd, Filesort *filesort, RowIterator *source_iterator,
                            sortlength(thd, filesort->sortorder, s_length),
                            filesort->tables, max_rows,
                            filesort->m_remove_duplicates);
+  param->max_sort_threads = thd->variables.filesort_max_threads;
+  param->thd = thd;
 
   fs_info->addon_fields = param->addon_fields;
 
@@ -594,7 +596,8 @@ bool filesort(THD *thd, Filesort *filesort, RowIterator *source_iterator,
                                                        : "rowid");
     sort_mode.append(">");
 
-    const char *algo_text[] = {"none", "std::sort", "std::stable_sort"};
+    const char *algo_text[] = {"none", "std::sort", "std::stable_sort",
+                               "radix_sort"};
 
     Opt_trace_object filesort_summary(trace, "filesort_summary");
     filesort_summary.add("memory_available", memory_available)
@@ -1099,6 +1102,9 @@ static int write_keys(Sort_param *param, Filesort_info *fs_info, uint count,
 
   count = fs_info->sort_buffer(param, count, param->max_rows);
 
+  // A killed sort may leave the buffer unsorted.
+  if (param->thd != nullptr && param->thd->killed) return 1;
+
   if (!my_b_inited(chunk_file) &&
       open_cached_file_encrypted(chunk_file, mysql_tmpdir, TEMP_PREFIX,
                                  DISK_BUFFER_SIZE, MYF(MY_WME),
@@ -1593,6 +1599,10 @@ static bool save_index(Sort_param *param, uint count, Filesort_info *table_sort,
                               param->using_varlen_keys());
 
   count = table_sort->sort_buffer(param, count, param->max_rows);
+
+  // A killed sort may leave the buffer unsorted.
+  if (param->thd != nullptr && param->thd->killed) return true;
+
   sort_result->found_records = count;
 
   if (param->using_addon_fields()) {
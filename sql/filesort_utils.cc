@@ -24,19 +24,30 @@
 
 #include <string.h>
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <thread>
+#include <vector>
 
 #include "add_with_saturate.h"
+#include "map_helpers.h"
 #include "my_dbug.h"
 #include "my_io.h"
 #include "my_pointer_arithmetic.h"
+#include "my_sys.h"
+#include "my_thread.h"
+#include "myisampack.h"
+#include "mysql/psi/mysql_thread.h"
 #include "sql/cmp_varlen_keys.h"
+#include "sql/mysqld.h"
 #include "sql/opt_costmodel.h"
 #include "sql/sort_param.h"
+#include "sql/sql_class.h"
 #include "sql/sql_sort.h"
 #include "sql/thr_malloc.h"
 
 PSI_memory_key key_memory_Filesort_buffer_sort_keys;
+PSI_thread_key key_thread_sort_helper;
 
 using std::max;
 using std::min;
@@ -62,16 +73,18 @@ inline bool my_mem_compare(const uchar *s1, const uchar *s2, size_t len) {
   return false;
 }
 
-#define COMPARE(N) \
-  if (s1[N] != s2[N]) return s1[N] < s2[N]
-
+/*
+  Keys of ten bytes or more. Most keys differ within the first eight bytes,
+  so compare those as one big-endian word (a single load and byte swap on
+  little-endian machines) before falling back to memcmp() for the rest.
+ */
 inline bool my_mem_compare_longkey(const uchar *s1, const uchar *s2,
                                    size_t len) {
-  COMPARE(0);
-  COMPARE(1);
-  COMPARE(2);
-  COMPARE(3);
-  return memcmp(s1 + 4, s2 + 4, len - 4) < 0;
+  assert(len >= 8);
+  const ulonglong prefix1 = mi_uint8korr(s1);
+  const ulonglong prefix2 = mi_uint8korr(s2);
+  if (prefix1 != prefix2) return prefix1 < prefix2;
+  return memcmp(s1 + 8, s2 + 8, len - 8) < 0;
 }
 
 class Mem_compare {
@@ -125,6 +138,171 @@ class Equality_from_less {
   const Comp &m_comp;
 };
 
+/**
+  Number of sort helper threads running in the server. Together with all
+  sessions, sorts don't start more helper threads than there are CPUs.
+ */
+std::atomic<uint> sort_helper_threads{0};
+
+/// Take one slot for a sort helper thread, if any is left.
+bool reserve_sort_helper_thread() {
+  DBUG_EXECUTE_IF("sort_helper_thread_unavailable", return false;);
+  static const uint max_helper_threads =
+      std::max(1U, std::thread::hardware_concurrency());
+  uint running = sort_helper_threads.load();
+  while (running < max_helper_threads) {
+    if (sort_helper_threads.compare_exchange_weak(running, running + 1))
+      return true;
+  }
+  return false;
+}
+
+template <class Fn>
+struct Sort_task {
+  const Fn *fn;
+  size_t index;
+};
+
+template <class Fn>
+void *run_sort_task(void *arg) {
+  my_thread_init();
+  const auto *task = static_cast<const Sort_task<Fn> *>(arg);
+  (*task->fn)(task->index);
+  my_thread_end();
+  sort_helper_threads.fetch_sub(1);
+  my_thread_exit(nullptr);
+  return nullptr;
+}
+
+/**
+  Run fn(0) ... fn(n_tasks - 1). Task 0 runs on the calling thread, the
+  others on helper threads as long as the server-wide limit allows. The
+  calling thread also runs any task that could not get a thread.
+ */
+template <class Fn>
+void run_sort_tasks(size_t n_tasks, const Fn &fn) {
+  vector<Sort_task<Fn>> tasks(n_tasks);
+  vector<my_thread_handle> workers;
+  workers.reserve(n_tasks - 1);
+  for (size_t i = 1; i < n_tasks; ++i) {
+    tasks[i] = {&fn, i};
+    my_thread_handle handle;
+    if (!reserve_sort_helper_thread()) {
+      fn(i);
+    } else if (mysql_thread_create(key_thread_sort_helper, &handle, nullptr,
+                                   run_sort_task<Fn>, &tasks[i]) != 0) {
+      sort_helper_threads.fetch_sub(1);
+      fn(i);
+    } else {
+      workers.push_back(handle);
+    }
+  }
+  fn(0);
+  for (my_thread_handle &worker : workers) my_thread_join(&worker, nullptr);
+}
+
+/// Do not hand fewer records than this to a separate sort thread.
+constexpr size_t MIN_RECORDS_PER_SORT_THREAD = 16384;
+
+/**
+  Sort [first, last) using up to max_threads threads. The range is split in
+  equal segments which are sorted concurrently, and the sorted segments are
+  then merged pairwise, again concurrently where the pairs are independent.
+  The merges keep the order between segments, so the result is stable if
+  sort_segment is.
+
+  If the session is killed, the remaining segments and merges are skipped
+  and the range is left partly sorted; the caller must check thd->killed.
+ */
+template <class It, class Comp, class Sort>
+void parallel_sort(It first, It last, Comp comp, const Sort_param *param,
+                   Sort sort_segment) {
+  const size_t num_records = last - first;
+  const size_t n_segments =
+      min<size_t>(param->max_sort_threads,
+                  num_records / MIN_RECORDS_PER_SORT_THREAD);
+  if (n_segments <= 1) {
+    sort_segment(first, last, comp);
+    return;
+  }
+
+  const THD *thd = param->thd;
+  const auto killed = [thd]() { return thd != nullptr && thd->killed; };
+
+  vector<size_t> bounds(n_segments + 1);
+  for (size_t i = 0; i <= n_segments; ++i) {
+    bounds[i] = num_records * i / n_segments;
+  }
+
+  run_sort_tasks(n_segments, [&](size_t i) {
+    if (killed()) return;
+    sort_segment(first + bounds[i], first + bounds[i + 1], comp);
+  });
+
+  for (size_t width = 1; width < n_segments; width *= 2) {
+    if (killed()) return;
+    const size_t n_merges = (n_segments - width + 2 * width - 1) / (2 * width);
+    run_sort_tasks(n_merges, [&](size_t merge) {
+      if (killed()) return;
+      const size_t i = merge * 2 * width;
+      std::inplace_merge(first + bounds[i], first + bounds[i + width],
+                         first + bounds[min(i + 2 * width, n_segments)], comp);
+    });
+  }
+}
+
+template <class It, class Comp>
+void parallel_stable_sort(It first, It last, Comp comp,
+                          const Sort_param *param) {
+  parallel_sort(first, last, comp, param,
+                [](It seg_first, It seg_last, const Comp &seg_comp) {
+                  stable_sort(seg_first, seg_last, seg_comp);
+                });
+}
+
+/// From this many records up, short keys are radix sorted.
+constexpr size_t MIN_RECORDS_FOR_RADIX_SORT = 4096;
+
+/**
+  Stable LSD radix sort of the record pointers in [first, last) on the first
+  key_len bytes of the records, which gives the same order as stable_sort()
+  with Mem_compare. There is one counting pass per key byte, and one
+  distribution pass per key byte that is not the same in all records; the
+  NULL indicator bytes and high-order bytes of packed integers and dates
+  are often constant and cost no more than the count.
+
+  @retval false on success
+  @retval true if the work buffer could not be allocated; nothing was done
+ */
+bool radix_sort_keys(uchar **first, uchar **last, size_t key_len) {
+  const size_t num_records = last - first;
+  unique_ptr_my_free<uchar *[]> work(static_cast<uchar **>(
+      my_malloc(key_memory_Filesort_buffer_sort_keys,
+                num_records * sizeof(uchar *), MYF(0))));
+  if (work == nullptr) return true;
+
+  uchar **src = first;
+  uchar **dst = work.get();
+  for (size_t byte = key_len; byte-- > 0;) {
+    size_t counts[256] = {0};
+    for (size_t i = 0; i < num_records; ++i) ++counts[src[i][byte]];
+    if (counts[src[0][byte]] == num_records) continue;
+
+    size_t offset = 0;
+    for (size_t &count : counts) {
+      const size_t records_with_value = count;
+      count = offset;
+      offset += records_with_value;
+    }
+    for (size_t i = 0; i < num_records; ++i) {
+      dst[counts[src[i][byte]]++] = src[i];
+    }
+    std::swap(src, dst);
+  }
+  if (src != first) std::copy(src, src + num_records, first);
+  return false;
+}
+
 }  // namespace
 
 size_t Filesort_buffer::sort_buffer(Sort_param *param, size_t num_input_rows,
@@ -155,7 +333,11 @@ size_t Filesort_buffer::sort_buffer(Sort_param *param, size_t num_input_rows,
     // TODO: Make more elaborate heuristics than just always picking
     // std::sort.
     param->m_sort_algorithm = Sort_param::FILESORT_ALG_STD_SORT;
-    sort(it_begin, it_end, comp);
+    parallel_sort(it_begin, it_end, comp, param,
+                  [](auto seg_first, auto seg_last,
+                     const Mem_compare_varlen_key &seg_comp) {
+                    sort(seg_first, seg_last, seg_comp);
+                  });
     if (param->m_remove_duplicates) {
       num_input_rows =
           unique(it_begin, it_end,
@@ -221,7 +403,14 @@ size_t Filesort_buffer::sort_buffer(Sort_param *param, size_t num_input_rows,
                   Mem_compare(key_len));
       it_end = it_begin + max_output_rows;
     }
-    stable_sort(it_begin, it_end, Mem_compare(key_len));
+    if (static_cast<size_t>(it_end - it_begin) >= MIN_RECORDS_FOR_RADIX_SORT &&
+        !radix_sort_keys(&*it_begin, &*it_begin + (it_end - it_begin),
+                         key_len)) {
+      param->m_sort_algorithm = Sort_param::FILESORT_ALG_RADIX;
+    } else {
+      parallel_stable_sort(it_begin, it_end, Mem_compare(key_len),
+                           param);
+    }
     if (param->m_remove_duplicates) {
       num_input_rows =
           unique(it_begin, it_end,
@@ -234,7 +423,8 @@ size_t Filesort_buffer::sort_buffer(Sort_param *param, size_t num_input_rows,
                   Mem_compare_longkey(key_len));
       it_end = it_begin + max_output_rows;
     }
-    stable_sort(it_begin, it_end, Mem_compare_longkey(key_len));
+    parallel_stable_sort(it_begin, it_end, Mem_compare_longkey(key_len),
+                         param);
     if (param->m_remove_duplicates) {
       num_input_rows = unique(it_begin, it_end,
                               Equality_from_less<Mem_compare_longkey>(
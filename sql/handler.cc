@@ -5442,7 +5442,20 @@ void handler::update_global_index_stats() {
       !table->s->table_name.str)
     return;
 
-  for (uint x = 0; x < table->s->keys; ++x) {
+  uint x = 0;
+  while (x < table->s->keys && !index_rows_read[x]) ++x;
+  if (x == table->s->keys) return;  // Nothing to update.
+
+  // [db] + '.' + [table] + '.', shared by every index of the table.
+  std::string key{table->s->table_cache_key.str};
+  key.append(1, '.');
+  key.append(table->s->table_name.str);
+  key.append(1, '.');
+  const size_t prefix_length = key.length();
+
+  // Take the lock once for all the indexes read through this handler.
+  mysql_mutex_lock(&LOCK_global_index_stats);
+  for (; x < table->s->keys; ++x) {
     if (index_rows_read[x]) {
       // Rows were read using this index.
       KEY *key_info = &table->key_info[x];
@@ -5450,24 +5463,19 @@ void handler::update_global_index_stats() {
       if (!key_info->name) continue;
 
       // [db] + '.' + [table] + '.' + [index]
-      std::string key{table->s->table_cache_key.str};
-      key.append(1, '.');
-      key.append(table->s->table_name.str);
-      key.append(1, '.');
+      key.resize(prefix_length);
       key.append(key_info->name);
-      key.shrink_to_fit();
 
-      mysql_mutex_lock(&LOCK_global_index_stats);
       const auto &it = global_index_stats->find(key);
       if (it == global_index_stats->cend()) {
         global_index_stats->emplace(key, index_rows_read[x]);
       } else {
         it->second += index_rows_read[x];
       }
-      mysql_mutex_unlock(&LOCK_global_index_stats);
       index_rows_read[x] = 0;
     }
   }
+  mysql_mutex_unlock(&LOCK_global_index_stats);
 }
 
 /****************************************************************************
@@ -6495,6 +6503,14 @@ ha_rows handler::multi_range_read_info_const(uint keyno, RANGE_SEQ_IF *seq,
   ha_rows rows, total_rows = 0;
   uint n_ranges = 0;
   THD *thd = current_thd;
+  /*
+    Estimates of equality ranges taken from index statistics, and the
+    index dives done for equality ranges flagged with SAMPLED_DIVE_RANGE.
+    If there are sampled dives, the average of these replaces the index
+    statistics estimate.
+  */
+  ha_rows statistics_rows = 0, sampled_rows = 0;
+  uint n_statistics_ranges = 0, n_sampled_ranges = 0;
 
   /* Default MRR implementation doesn't need buffer */
   *bufsz = 0;
@@ -6557,6 +6573,9 @@ ha_rows handler::multi_range_read_info_const(uint keyno, RANGE_SEQ_IF *seq,
             a) Index statistics is available.
             b) The range is an equality range but the index is either not
                unique or all of the keyparts are not used.
+            If some equality ranges were flagged with SAMPLED_DIVE_RANGE,
+            the index statistics estimate is replaced by the average of
+            these index dives after all ranges have been seen.
     */
     int keyparts_used = 0;
     if ((range.range_flag & UNIQUE_RANGE) &&  // 1)
@@ -6567,8 +6586,10 @@ ha_rows handler::multi_range_read_info_const(uint keyno, RANGE_SEQ_IF *seq,
       if ((range.range_flag & EQ_RANGE) &&
           (keyparts_used = my_count_bits(range.start_key.keypart_map)) &&
           table->key_info[keyno].has_records_per_key(keyparts_used - 1)) {
-        rows = static_cast<ha_rows>(
+        statistics_rows += static_cast<ha_rows>(
             table->key_info[keyno].records_per_key(keyparts_used - 1));
+        n_statistics_ranges++;
+        continue;
       } else {
         /*
           Since records_in_range has not been called, set the rows to 1.
@@ -6586,10 +6607,20 @@ ha_rows handler::multi_range_read_info_const(uint keyno, RANGE_SEQ_IF *seq,
         /* Can't scan one range => can't do MRR scan at all */
         return HA_POS_ERROR;
       }
+      if (range.range_flag & SAMPLED_DIVE_RANGE) {
+        sampled_rows += rows;
+        n_sampled_ranges++;
+      }
     }
     total_rows += rows;
   }
 
+  if (n_sampled_ranges > 0)
+    total_rows += static_cast<ha_rows>(static_cast<double>(sampled_rows) *
+                                       n_statistics_ranges / n_sampled_ranges);
+  else
+    total_rows += statistics_rows;
+
   assert(total_rows != HA_POS_ERROR);
   {
     const Cost_model_table *const cost_model = table->cost_model();
@@ -7114,6 +7145,8 @@ int DsMrr_impl::dsmrr_fill_buffer() {
       [this](const uchar *a, const uchar *b) { return h->cmp_ref(a, b) < 0; });
   rowids_buf_last = rowids_buf_cur;
   rowids_buf_cur = rowids_buf;
+
+  h->prefetch_positions(rowids_buf, rowids_buf_last, elem_size);
   return 0;
 }
 
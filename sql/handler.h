@@ -4963,6 +4963,18 @@ class handler {
   */
   virtual void parallel_scan_end(void *scan_ctx [[maybe_unused]]) { return; }
 
+  /**
+    Hint that rows are about to be read with rnd_pos() at the given
+    positions, so that the engine can start fetching them. Used by DS-MRR
+    after it has sorted a buffer of positions.
+    @param[in]  positions  First position, as returned by position()
+    @param[in]  end        End of the positions
+    @param[in]  stride     Distance in bytes between consecutive positions
+  */
+  virtual void prefetch_positions(const uchar *positions [[maybe_unused]],
+                                  const uchar *end [[maybe_unused]],
+                                  size_t stride [[maybe_unused]]) {}
+
   /**
     Submit a dd::Table object representing a core DD table having
     hardcoded data to be filled in by the DDSE. This function can be
@@ -201,6 +201,14 @@ class LinkedImmutableString {
   inline bool operator==(std::nullptr_t) const { return m_ptr == nullptr; }
   inline bool operator!=(std::nullptr_t) const { return m_ptr != nullptr; }
 
+  /// Hint to the CPU that this string is about to be decoded, so that the
+  /// cache miss on it can overlap with other work. Must not be nullptr.
+  inline void Prefetch() const {
+#if defined(__GNUC__)
+    __builtin_prefetch(m_ptr);
+#endif
+  }
+
  private:
   const char *m_ptr;
 };
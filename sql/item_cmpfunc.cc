@@ -4310,8 +4310,41 @@ class Cmp_longlong {
   }
 };
 
+in_longlong::in_longlong(MEM_ROOT *mem_root, uint elements)
+    : in_vector(elements), base(mem_root, elements), m_hash_slots(mem_root) {
+  if (elements >= MIN_HASHED_ELEMENTS) {
+    size_t slots = 1;
+    while (slots < 2 * static_cast<size_t>(elements)) slots <<= 1;
+    m_hash_slots.resize(slots, EMPTY_HASH_SLOT);
+    if (m_hash_slots.size() != slots) m_hash_slots.clear();
+  }
+}
+
+/**
+  Values that are equal according to cmp_longlong() have the same bit
+  pattern regardless of signedness, so only the value is hashed.
+*/
+uint in_longlong::hash_slot(longlong val) const {
+  const ulonglong hash =
+      static_cast<ulonglong>(val) * 0x9E3779B97F4A7C15ULL;  // Fibonacci hashing
+  return static_cast<uint>(hash >> 32) & (m_hash_slots.size() - 1);
+}
+
+void in_longlong::build_hash_slots() {
+  std::fill(m_hash_slots.begin(), m_hash_slots.end(), EMPTY_HASH_SLOT);
+  for (uint pos = 0; pos < m_used_size; pos++) {
+    // The array is sorted, so duplicates are adjacent and need one entry.
+    if (pos > 0 && cmp_longlong(&base[pos - 1], &base[pos]) == 0) continue;
+    uint slot = hash_slot(base[pos].val);
+    while (m_hash_slots[slot] != EMPTY_HASH_SLOT)
+      slot = (slot + 1) & (m_hash_slots.size() - 1);
+    m_hash_slots[slot] = pos;
+  }
+}
+
 void in_longlong::sort_array() {
   std::sort(base.begin(), base.begin() + m_used_size, Cmp_longlong());
+  if (!m_hash_slots.empty()) build_hash_slots();
 }
 
 bool in_longlong::find_item(Item *item) {
@@ -4319,6 +4352,14 @@ bool in_longlong::find_item(Item *item) {
   packed_longlong result;
   val_item(item, &result);
   if (item->null_value) return false;
+  if (!m_hash_slots.empty()) {
+    for (uint slot = hash_slot(result.val);
+         m_hash_slots[slot] != EMPTY_HASH_SLOT;
+         slot = (slot + 1) & (m_hash_slots.size() - 1)) {
+      if (cmp_longlong(&base[m_hash_slots[slot]], &result) == 0) return true;
+    }
+    return false;
+  }
   return std::binary_search(base.begin(), base.begin() + m_used_size, result,
                             Cmp_longlong());
 }
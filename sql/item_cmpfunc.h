@@ -1670,12 +1670,26 @@ class in_longlong : public in_vector {
     bool unsigned_flag;
   };
 
+  /// IN-lists with at least this many elements are probed through a hash
+  /// table instead of by binary search.
+  static constexpr uint MIN_HASHED_ELEMENTS = 64;
+
  protected:
   Mem_root_array<packed_longlong> base;
 
+ private:
+  /**
+    Open addressing hash table (linear probing) of positions in base, with
+    a power-of-two number of slots at least twice the number of elements.
+    Empty if the list is too small to be hashed or allocation failed, in
+    which case find_item() falls back to binary search.
+  */
+  Mem_root_array<uint> m_hash_slots;
+  /// Marks an unused slot in m_hash_slots.
+  static constexpr uint EMPTY_HASH_SLOT = ~0U;
+
  public:
-  in_longlong(MEM_ROOT *mem_root, uint elements)
-      : in_vector(elements), base(mem_root, elements) {}
+  in_longlong(MEM_ROOT *mem_root, uint elements);
   Item_basic_constant *create_item(MEM_ROOT *mem_root) const override {
     /*
       We've created a signed INT, this may not be correct in the
@@ -1694,6 +1708,8 @@ class in_longlong : public in_vector {
   void set(uint pos, Item *item) override { val_item(item, &base[pos]); }
   void sort_array() override;
   virtual void val_item(Item *item, packed_longlong *result);
+  void build_hash_slots();
+  uint hash_slot(longlong val) const;
 };
 
 class in_datetime_as_longlong final : public in_longlong {
@@ -49,6 +49,7 @@
 #include "sql/join_optimizer/access_path.h"
 #include "sql/join_optimizer/materialize_path_parameters.h"
 #include "sql/key.h"
+#include "sql/mysqld.h"  // temptable_hton
 #include "sql/opt_trace.h"
 #include "sql/opt_trace_context.h"
 #include "sql/pfs_batch_mode.h"
@@ -1625,6 +1626,10 @@ class TemptableAggregateIterator final : public TableRowIterator {
   */
   Profiler m_table_iter_profiler;
 
+  /// Key of the group whose updated row is held in record[1], if any; see
+  /// Init(). Allocated on first use.
+  uchar *m_last_group_key{nullptr};
+
   // See MaterializeIterator::doing_hash_deduplication().
   bool using_hash_key() const { return table()->hash_field; }
 
@@ -1708,6 +1713,24 @@ bool TemptableAggregateIterator<Profiler>::Init() {
   auto end_unique_index =
       create_scope_guard([&] { table()->file->ha_index_end(); });
 
+  // Consecutive input rows often belong to the same group, e.g. when the
+  // input is partially ordered on the grouping columns. After a group's row
+  // has been updated, keep its key and its new contents in record[1]. If the
+  // next input row has the same key, the TempTable index cursor is still on
+  // that group's row, so the lookup can be skipped. Blobs are excluded, as
+  // record[1] would only hold pointers into storage owned by the handler.
+  const size_t group_key_length =
+      using_hash_key() ? 0 : table()->key_info[0].key_length;
+  bool can_skip_group_lookup = false;
+  if (!using_hash_key() && table()->s->blob_fields == 0 &&
+      table()->s->db_type() == temptable_hton) {
+    if (m_last_group_key == nullptr) {
+      m_last_group_key = thd()->mem_root->ArrayAlloc<uchar>(group_key_length);
+    }
+    can_skip_group_lookup = m_last_group_key != nullptr;
+  }
+  bool last_group_in_record_1 = false;
+
   PFSBatchMode pfs_batch_mode(m_subquery_iterator.get());
   for (;;) {
     int read_error = m_subquery_iterator->Read();
@@ -1748,8 +1771,14 @@ bool TemptableAggregateIterator<Profiler>::Init() {
           group->buff[-1] = (char)group->field_in_tmp_table->is_null();
       }
       const uchar *key = m_temp_table_param->group_buff;
-      group_found = !table()->file->ha_index_read_map(
-          table()->record[1], key, HA_WHOLE_KEY, HA_READ_KEY_EXACT);
+      if (last_group_in_record_1 &&
+          memcmp(key, m_last_group_key, group_key_length) == 0) {
+        group_found = true;
+      } else {
+        last_group_in_record_1 = false;
+        group_found = !table()->file->ha_index_read_map(
+            table()->record[1], key, HA_WHOLE_KEY, HA_READ_KEY_EXACT);
+      }
     }
     if (group_found) {
       // Update the existing record. (If it's unchanged, that's a
@@ -1773,6 +1802,8 @@ bool TemptableAggregateIterator<Profiler>::Init() {
         move the table to disk and retry the update operation.
       */
       if (error != 0 && error != HA_ERR_RECORD_IS_THE_SAME) {
+        last_group_in_record_1 = false;
+        can_skip_group_lookup = false;
         if (move_table_to_disk(error, /*insert_operation=*/false)) {
           end_unique_index.commit();
           return true;
@@ -1810,10 +1841,17 @@ bool TemptableAggregateIterator<Profiler>::Init() {
           PrintError(error);
           return true;
         }
+      } else if (can_skip_group_lookup) {
+        store_record(table(), record[1]);
+        memcpy(m_last_group_key, m_temp_table_param->group_buff,
+               group_key_length);
+        last_group_in_record_1 = true;
       }
       continue;
     }
 
+    last_group_in_record_1 = false;
+
     // OK, we need to insert a new row; we need to materialize any items
     // that we are doing GROUP BY on.
 
@@ -1874,6 +1912,7 @@ bool TemptableAggregateIterator<Profiler>::Init() {
         }
       }
 
+      can_skip_group_lookup = false;
       if (move_table_to_disk(error, /*insert_operation=*/true)) {
         end_unique_index.commit();
         return true;
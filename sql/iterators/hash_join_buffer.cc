@@ -126,7 +126,7 @@ HashJoinRowBuffer::HashJoinRowBuffer(
   m_mem_root.set_max_capacity(0);
 }
 
-bool HashJoinRowBuffer::Init() {
+bool HashJoinRowBuffer::Init(double expected_rows) {
   if (m_hash_map.get() != nullptr) {
     // Reset the unique_ptr, so that the hash map destructors are called before
     // clearing the MEM_ROOT.
@@ -151,6 +151,30 @@ bool HashJoinRowBuffer::Init() {
     return true;
   }
 
+  // Size the hash map for the rows we expect up front, so that a large build
+  // does not rehash every key several times while the map doubles in size.
+  // The estimate may be far off, so never let the empty map take more than a
+  // quarter of the memory budget; lacking that, it will grow as usual.
+  if (expected_rows > 1.0) {
+    const size_t expected_keys = static_cast<size_t>(
+        std::min(expected_rows, static_cast<double>(m_max_mem_available)));
+    size_t buckets = 1;
+    while (m_hash_map->calcMaxNumElementsAllowed(buckets) < expected_keys) {
+      buckets *= 2;
+    }
+    while (buckets > 1 &&
+           m_hash_map->calcNumBytesTotal(buckets) > m_max_mem_available / 4) {
+      buckets /= 2;
+    }
+    try {
+      m_hash_map->reserve(m_hash_map->calcMaxNumElementsAllowed(buckets));
+    } catch (const std::bad_alloc &) {
+      // Not fatal; the map will grow on demand instead.
+    } catch (const std::overflow_error &) {
+      // Not fatal; the map will grow on demand instead.
+    }
+  }
+
   m_last_row_stored = LinkedImmutableString{nullptr};
   return false;
 }
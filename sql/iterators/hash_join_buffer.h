@@ -169,7 +169,10 @@ class HashJoinRowBuffer {
   // Initialize the HashJoinRowBuffer so it is ready to store rows. This
   // function can be called multiple times; subsequent calls will only clear the
   // buffer for existing rows.
-  bool Init();
+  //
+  // @param expected_rows the number of rows the caller expects to store, used
+  //        to size the hash map up front. 0 if unknown.
+  bool Init(double expected_rows = 0.0);
 
   /// Store the row that is currently lying in the tables record buffers.
   /// The hash map key is extracted from the join conditions that the row buffer
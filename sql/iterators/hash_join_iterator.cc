@@ -85,6 +85,7 @@ HashJoinIterator::HashJoinIterator(
       m_join_conditions(PSI_NOT_INSTRUMENTED, join_conditions.data(),
                         join_conditions.data() + join_conditions.size()),
       m_chunk_files_on_disk(thd->mem_root, kMaxChunks),
+      m_spilled_key_filter(thd->mem_root),
       m_estimated_build_rows(estimated_build_rows),
       m_probe_input_batch_mode(probe_input_batch_mode),
       m_allow_spill_to_disk(allow_spill_to_disk),
@@ -108,8 +109,8 @@ HashJoinIterator::HashJoinIterator(
   }
 }
 
-bool HashJoinIterator::InitRowBuffer() {
-  if (m_row_buffer.Init()) {
+bool HashJoinIterator::InitRowBuffer(double expected_rows) {
+  if (m_row_buffer.Init(expected_rows)) {
     assert(thd()->is_error());  // my_error should have been called.
     return true;
   }
@@ -224,6 +225,7 @@ bool HashJoinIterator::Init() {
 
   // Close any leftover files from previous iterations.
   m_chunk_files_on_disk.clear();
+  m_spilled_key_filter.clear();
 
   m_build_chunk_current_row = 0;
   m_probe_chunk_current_row = 0;
@@ -286,12 +288,45 @@ static bool ConstructJoinKey(
 // (record[0]) for each involved table. The row is put into one of the chunks in
 // the input vector "chunks"; which chunk to use is decided by the hash value of
 // the join attribute.
+// The spilled key filter is a Bloom filter over the join keys of all build
+// rows that were written out to chunk files. Probe rows whose key is not in
+// the filter cannot match anything on disk. Each key sets two bits. The low
+// bits of the partitioning hash select the chunk, so the bit positions are
+// taken from the high bits of the hash and of a multiplicative rehash of it.
+static inline void SpilledKeyFilterBits(const Mem_root_array<uint64_t> &filter,
+                                        uint64_t join_key_hash, uint64_t *bit1,
+                                        uint64_t *bit2) {
+  const uint shift = 64 - my_bit_log2(filter.size() * 64);
+  *bit1 = join_key_hash >> shift;
+  *bit2 = (join_key_hash * 0x9E3779B97F4A7C15ULL) >> shift;
+}
+
+static inline void AddToSpilledKeyFilter(Mem_root_array<uint64_t> *filter,
+                                         uint64_t join_key_hash) {
+  uint64_t bit1, bit2;
+  SpilledKeyFilterBits(*filter, join_key_hash, &bit1, &bit2);
+  (*filter)[bit1 / 64] |= uint64_t{1} << (bit1 % 64);
+  (*filter)[bit2 / 64] |= uint64_t{1} << (bit2 % 64);
+}
+
+static inline bool SpilledKeyFilterMayContain(
+    const Mem_root_array<uint64_t> &filter, uint64_t join_key_hash) {
+  uint64_t bit1, bit2;
+  SpilledKeyFilterBits(filter, join_key_hash, &bit1, &bit2);
+  return (filter[bit1 / 64] & (uint64_t{1} << (bit1 % 64))) != 0 &&
+         (filter[bit2 / 64] & (uint64_t{1} << (bit2 % 64))) != 0;
+}
+
+// Write the row lying in the record buffers of the given tables to the chunk
+// its join key hashes to. If spilled_key_filter is not nullptr, build rows add
+// their key to it, and probe rows whose key is not in it are not written out.
 static bool WriteRowToChunk(
     THD *thd, Mem_root_array<ChunkPair> *chunks, bool write_to_build_chunk,
     const pack_rows::TableCollection &tables,
     const Prealloced_array<HashJoinCondition, 4> &join_conditions,
     const uint32 xxhash_seed, bool row_has_match,
-    bool store_row_with_null_in_join_key, String *join_key_and_row_buffer) {
+    bool store_row_with_null_in_join_key, String *join_key_and_row_buffer,
+    Mem_root_array<uint64_t> *spilled_key_filter) {
   assert(!thd->is_error());
   bool null_in_join_key = ConstructJoinKey(
       thd, join_conditions, tables.tables_bitmap(), join_key_and_row_buffer);
@@ -310,6 +345,15 @@ static bool WriteRowToChunk(
           : MY_XXH64(join_key_and_row_buffer->ptr(),
                      join_key_and_row_buffer->length(), xxhash_seed);
 
+  if (spilled_key_filter != nullptr) {
+    if (write_to_build_chunk) {
+      AddToSpilledKeyFilter(spilled_key_filter, join_key_hash);
+    } else if (!SpilledKeyFilterMayContain(*spilled_key_filter,
+                                           join_key_hash)) {
+      return false;
+    }
+  }
+
   assert((chunks->size() & (chunks->size() - 1)) == 0);
   // Since we know that the number of chunks will be a power of two, do a
   // bitwise AND instead of (join_key_hash % chunks->size()).
@@ -332,7 +376,8 @@ static bool WriteRowsToChunks(
     const Prealloced_array<HashJoinCondition, 4> &join_conditions,
     const uint32 xxhash_seed, Mem_root_array<ChunkPair> *chunks,
     bool write_to_build_chunk, bool write_rows_with_null_in_join_key,
-    table_map tables_to_get_rowid_for, String *join_key_buffer) {
+    table_map tables_to_get_rowid_for, String *join_key_buffer,
+    Mem_root_array<uint64_t> *spilled_key_filter) {
   for (;;) {  // Termination condition within loop.
     int res = iterator->Read();
     if (res == 1) {
@@ -350,7 +395,8 @@ static bool WriteRowsToChunks(
     RequestRowId(tables.tables(), tables_to_get_rowid_for);
     if (WriteRowToChunk(thd, chunks, write_to_build_chunk, tables,
                         join_conditions, xxhash_seed, /*row_has_match=*/false,
-                        write_rows_with_null_in_join_key, join_key_buffer)) {
+                        write_rows_with_null_in_join_key, join_key_buffer,
+                        spilled_key_filter)) {
       assert(thd->is_error());  // my_error should have been called.
       return true;
     }
@@ -439,7 +485,7 @@ bool HashJoinIterator::BuildHashTable() {
                                         m_row_buffer.LastRowStored());
   }
 
-  if (InitRowBuffer()) {
+  if (InitRowBuffer(m_estimated_build_rows)) {
     return true;
   }
 
@@ -515,6 +561,24 @@ bool HashJoinIterator::BuildHashTable() {
           return true;
         }
 
+        // Inner joins and semijoins output nothing for a probe row without a
+        // match, so such probe rows need not be written to disk either. Keep
+        // a filter of the spilled build keys to recognize them. Size it for
+        // about eight bits per expected build row.
+        m_spilled_key_filter.clear();
+        if (m_join_type == JoinType::INNER || m_join_type == JoinType::SEMI) {
+          constexpr double kMinFilterWords = 1024;             // 8 kB
+          constexpr double kMaxFilterWords = 2 * 1024 * 1024;  // 16 MB
+          const double filter_words = std::clamp(
+              std::max<double>(m_estimated_build_rows, m_row_buffer.size()) *
+                  8 / 64,
+              kMinFilterWords, kMaxFilterWords);
+          // If the filter cannot be allocated, it stays empty and all probe
+          // rows are written out as before.
+          m_spilled_key_filter.resize(
+              my_round_up_to_next_power(static_cast<uint32>(filter_words)), 0);
+        }
+
         // Write out the remaining rows from the build input out to chunk files.
         // The probe input will be written out to chunk files later; we will do
         // it _after_ we have checked the probe input for matches against the
@@ -533,7 +597,10 @@ bool HashJoinIterator::BuildHashTable() {
                               true /* write_to_build_chunks */,
                               false /* write_rows_with_null_in_join_key */,
                               m_tables_to_get_rowid_for,
-                              &m_temporary_row_and_join_key_buffer)) {
+                              &m_temporary_row_and_join_key_buffer,
+                              m_spilled_key_filter.empty()
+                                  ? nullptr
+                                  : &m_spilled_key_filter)) {
           assert(thd()->is_error() ||
                  thd()->killed);  // my_error should have been called.
           return true;
@@ -597,13 +664,15 @@ bool HashJoinIterator::ReadNextHashJoinChunk() {
     return false;
   }
 
-  if (InitRowBuffer()) {
-    return true;
-  }
-
   HashJoinChunk &build_chunk =
       m_chunk_files_on_disk[m_current_chunk].build_chunk;
 
+  const ha_rows rows_left_in_chunk =
+      build_chunk.num_rows() - m_build_chunk_current_row;
+  if (InitRowBuffer(static_cast<double>(rows_left_in_chunk))) {
+    return true;
+  }
+
   const bool reject_duplicate_keys = RejectDuplicateKeys();
   for (; m_build_chunk_current_row < build_chunk.num_rows();
        ++m_build_chunk_current_row) {
@@ -898,6 +967,14 @@ int HashJoinIterator::ReadJoinedRow() {
     return -1;
   }
 
+  // Rows with the same key are chained, and the next one is usually far from
+  // this one in the MEM_ROOT. Start fetching it now, so that walking a long
+  // chain does not stall on a cache miss for every row.
+  const LinkedImmutableString next_row = m_current_row.Decode().next;
+  if (next_row != nullptr) {
+    next_row.Prefetch();
+  }
+
   // A row is ready in the hash table, so put the data from the hash table row
   // into the record buffers of the build input tables.
   LoadImmutableStringIntoTableBuffers(m_build_input_tables, m_current_row);
@@ -924,7 +1001,10 @@ bool HashJoinIterator::WriteProbeRowToDiskIfApplicable() {
                             m_probe_input_tables, m_join_conditions,
                             kChunkPartitioningHashSeed, found_match,
                             write_rows_with_null_in_join_key,
-                            &m_temporary_row_and_join_key_buffer)) {
+                            &m_temporary_row_and_join_key_buffer,
+                            m_spilled_key_filter.empty()
+                                ? nullptr
+                                : &m_spilled_key_filter)) {
           return true;
         }
       }
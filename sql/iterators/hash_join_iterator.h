@@ -438,8 +438,10 @@ class HashJoinIterator final : public RowIterator {
   /// Clear the row buffer and reset all iterators pointing to it. This may be
   /// called multiple times to re-init the row buffer.
   ///
+  /// @param expected_rows the number of rows we expect to store, used to size
+  ///        the hash table up front
   /// @retval true in case of error. my_error has been called
-  bool InitRowBuffer();
+  bool InitRowBuffer(double expected_rows);
 
   /// Prepare to read the probe iterator from the beginning, and enable batch
   /// mode if applicable. The iterator state will remain unchanged.
@@ -530,6 +532,11 @@ class HashJoinIterator final : public RowIterator {
   // on-disk hash join.
   Mem_root_array<ChunkPair> m_chunk_files_on_disk;
 
+  // A Bloom filter over the join keys of the build rows written to chunk
+  // files, used to avoid writing probe rows that cannot match any of them.
+  // Only used for on-disk inner joins and semijoins; empty otherwise.
+  Mem_root_array<uint64_t> m_spilled_key_filter;
+
   // Which HashJoinChunk, if any, we are currently reading from, in both
   // LOADING_NEXT_CHUNK_PAIR and READING_ROW_FROM_PROBE_CHUNK_FILE.
   // It is incremented during the state LOADING_NEXT_CHUNK_PAIR.
@@ -162,6 +162,7 @@ bool buffer_record_somewhere(THD *thd, Window *w, int64 rowno) {
 
     assert(t->s->db_type() == innodb_hton);
     if (t->file->ha_rnd_init(true)) return true; /* purecov: inspected */
+    w->m_frame_buffer_cursor_rowno = -1;
 
     if (!w->m_frame_buffer_positions.empty()) {
       /*
@@ -221,6 +222,7 @@ bool buffer_record_somewhere(THD *thd, Window *w, int64 rowno) {
 
     // Do a read to establish scan position, then get it
     error = t->file->ha_rnd_next(record);
+    w->m_frame_buffer_cursor_rowno = error == 0 ? 1 : -1;
     t->file->position(record);
     std::memcpy(w->m_frame_buffer_positions[first_in_partition].m_position,
                 t->file->ref, t->file->ref_length);
@@ -292,6 +294,23 @@ bool read_frame_buffer_row(int64 rowno, Window *w,
   int diff = w->last_rowno_in_cache();  // maximum a priori
   TABLE *t = w->frame_buffer();
 
+  /*
+    Visiting the rows of a frame one after the other is the most common
+    access pattern. If the cursor is on the row just before the one we want,
+    read on from there rather than repositioning on a saved hint first.
+  */
+  if (w->m_frame_buffer_cursor_rowno != -1 &&
+      rowno == w->m_frame_buffer_cursor_rowno + 1) {
+    const int error = t->file->ha_rnd_next(t->record[0]);
+    if (error) {
+      w->m_frame_buffer_cursor_rowno = -1;
+      t->file->print_error(error, MYF(0));
+      return true;
+    }
+    w->m_frame_buffer_cursor_rowno = rowno;
+    return false;
+  }
+
   // Find the saved position closest to where we want to go
   for (int i = w->m_frame_buffer_positions.size() - 1; i >= 0; i--) {
     Window::Frame_buffer_position cand = w->m_frame_buffer_positions[i];
@@ -306,6 +325,7 @@ bool read_frame_buffer_row(int64 rowno, Window *w,
 
   Window::Frame_buffer_position *cand = &w->m_frame_buffer_positions[use_idx];
 
+  w->m_frame_buffer_cursor_rowno = -1;
   int error =
       t->file->ha_rnd_pos(w->frame_buffer()->record[0], cand->m_position);
   if (error) {
@@ -347,6 +367,7 @@ bool read_frame_buffer_row(int64 rowno, Window *w,
     }
   }
 
+  w->m_frame_buffer_cursor_rowno = rowno;
   return false;
 }
 
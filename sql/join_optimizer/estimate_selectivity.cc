@@ -157,6 +157,56 @@ static double EstimateFieldSelectivity(Field *field, double *selectivity_cap,
   return std::min(selectivity, 1.0);
 }
 
+/**
+  Estimate the selectivity of the equijoin left = right from the histograms
+  on both fields. Used only when neither field starts an index, since index
+  cardinality is preferred when present (see EstimateFieldSelectivity()).
+
+  Under the usual containment assumption, every non-NULL value on the side
+  with fewer distinct values finds a match on the other side, so the join
+  selectivity is
+
+    non_null(left) * non_null(right) / max(NDV(left), NDV(right))
+
+  Unlike combining the per-field estimates, this accounts for the NULLs on
+  both sides and does not fall back to the side with the fewest distinct
+  values. Returns -1.0 if either field lacks a usable histogram.
+ */
+static double EstimateHistogramJoinSelectivity(const Field *left,
+                                               const Field *right,
+                                               string *trace) {
+  const histograms::Histogram *histograms[2];
+  int i = 0;
+  for (const Field *field : {left, right}) {
+    if (!field->key_start.is_clear_all()) return -1.0;
+    histograms[i] = field->table->s->find_histogram(field->field_index());
+    if (histograms[i] == nullptr || empty(*histograms[i])) return -1.0;
+    ++i;
+  }
+
+  const double distinct_values = std::max<double>(
+      {1.0, static_cast<double>(histograms[0]->get_num_distinct_values()),
+       static_cast<double>(histograms[1]->get_num_distinct_values())});
+  const double selectivity = histograms[0]->get_non_null_values_fraction() *
+                             histograms[1]->get_non_null_values_fraction() /
+                             distinct_values;
+
+  if (trace != nullptr) {
+    std::ostringstream stream;
+    stream << " - estimating selectivity " << selectivity << " for join of "
+           << left->table->alias << "." << left->field_name << " and "
+           << right->table->alias << "." << right->field_name
+           << " from histograms showing "
+           << histograms[0]->get_num_distinct_values() << " and "
+           << histograms[1]->get_num_distinct_values()
+           << " distinct values and non-null fractions "
+           << histograms[0]->get_non_null_values_fraction() << " and "
+           << histograms[1]->get_non_null_values_fraction() << ".\n";
+    *trace += stream.str();
+  }
+  return std::min(selectivity, 1.0);
+}
+
 /**
   For the given condition, to try estimate its filtering selectivity,
   on a 0..1 scale (where 1.0 lets all records through).
@@ -190,7 +240,12 @@ double EstimateSelectivity(THD *thd, Item *condition, string *trace) {
       Item *right = eq->arguments()[1];
       if (left->type() == Item::FIELD_ITEM &&
           right->type() == Item::FIELD_ITEM) {
-        double selectivity = -1.0;
+        double selectivity = EstimateHistogramJoinSelectivity(
+            down_cast<Item_field *>(left)->field,
+            down_cast<Item_field *>(right)->field, trace);
+        if (selectivity >= 0.0) {
+          return selectivity;
+        }
         for (Field *field : {down_cast<Item_field *>(left)->field,
                              down_cast<Item_field *>(right)->field}) {
           selectivity = std::max(
@@ -160,6 +160,15 @@ class Sel_arg_range_sequence {
   uint range_count = 0;
   uint max_key_part;
 
+  /*
+    If non-zero, every sample_stride'th equality range gets an index
+    dive even though use_index_statistics is set.
+    @see eq_range_index_dive_sample
+  */
+  uint sample_stride = 0;
+  /* Number of equality ranges returned so far */
+  uint eq_range_count = 0;
+
   Sel_arg_range_sequence(RANGE_OPT_PARAM *param_arg, bool *is_ror_scan_arg,
                          uchar *min_key_arg, uchar *max_key_arg,
                          bool skip_records_in_range_arg)
@@ -519,8 +528,14 @@ static uint sel_arg_range_seq_next(range_seq_t rseq, KEY_MULTI_RANGE *range) {
         Use statistics instead of index dives for estimates of rows in
         this range if the user requested it
       */
-      if (param->use_index_statistics)
-        range->range_flag |= SKIP_RECORDS_IN_RANGE;
+      if (param->use_index_statistics) {
+        if (seq->sample_stride != 0 &&
+            seq->eq_range_count % seq->sample_stride == 0)
+          range->range_flag |= SAMPLED_DIVE_RANGE;
+        else
+          range->range_flag |= SKIP_RECORDS_IN_RANGE;
+      }
+      seq->eq_range_count++;
 
       /*
         An equality range is a unique range (0 or 1 rows in the range)
@@ -602,6 +617,19 @@ ha_rows check_quick_select(THD *thd, RANGE_OPT_PARAM *param, uint idx,
   uint range_count = 0;
   param->use_index_statistics = eq_ranges_exceeds_limit(
       tree, &range_count, thd->variables.eq_range_index_dive_limit);
+  /*
+    Instead of ignoring index dives altogether, sample some of the
+    equality ranges if requested. The number of equality ranges is
+    needed to space the samples evenly over the whole list.
+  */
+  const uint dive_sample = thd->variables.eq_range_index_dive_sample;
+  if (param->use_index_statistics && dive_sample != 0 &&
+      !skip_records_in_range) {
+    uint eq_range_count = 0;
+    eq_ranges_exceeds_limit(tree, &eq_range_count, UINT_MAX);
+    if (eq_range_count > 0)
+      seq.sample_stride = 1 + (eq_range_count - 1) / dive_sample;
+  }
   *is_imerge_scan = true;
   *is_ror_scan = !(file->index_flags(keynr, 0, true) & HA_KEY_SCAN_NOT_ROR);
 
@@ -257,10 +257,20 @@ bool Regexp_facade::SetupEngine(Item *pattern_expr, uint flags) {
     return false;
   }
 
+  /*
+    A non-constant pattern often has the same value for many rows, e.g.
+    when it comes from a joined table. Reuse the compiled expression then,
+    which also avoids allocating a new engine on THR_MALLOC for every row.
+  */
+  if (m_engine != nullptr && !m_engine->IsError() &&
+      pattern == m_current_pattern && flags == m_engine->flags())
+    return false;
+
   // Actually compile the regular expression.
   m_engine = make_unique_destroy_only<Regexp_engine>(
       *THR_MALLOC, pattern, flags, opt_regexp_stack_limit,
       opt_regexp_time_limit);
+  m_current_pattern = std::move(pattern);
 
   // If something went wrong, an error was raised.
   return m_engine->IsError();
@@ -123,7 +123,10 @@ class Regexp_facade {
   String *Substr(Item *subject_expr, int start, int occurrence, String *result);
 
   /// Delete the "engine" data structure after execution.
-  void cleanup() { m_engine = nullptr; }
+  void cleanup() {
+    m_engine = nullptr;
+    m_current_pattern.clear();
+  }
 
   /// Did any operation return a warning? For unit testing.
   bool EngineHasWarning() const {
@@ -191,6 +194,13 @@ class Regexp_facade {
     @see Regexp_engine::reset()
   */
   std::u16string m_current_subject;
+
+  /**
+    The pattern that m_engine was compiled from. Lets SetupEngine() skip
+    recompilation when a non-constant pattern evaluates to the same string
+    as for the previous row.
+  */
+  std::u16string m_current_pattern;
 };
 
 }  // namespace regexp
@@ -196,7 +196,9 @@ void Commit_order_trx_dependency_tracker::update_max_committed(
   Commit_order_trx_dependency_tracker and tries to make the commit_parent as
   low as possible, using the writesets of each transaction.
   The commit_parent returned depends on how many row hashes are stored in the
-  writeset_history, which is cleared once it reaches the user-defined maximum.
+  writeset_history. Once it reaches the user-defined maximum the older half of
+  the history is evicted, and it is only cleared entirely when that does not
+  free enough room for the current transaction.
 
   @param[in]     thd             Current THD from which to extract trx context.
   @param[in,out] sequence_number Sequence number of current transaction.
@@ -245,11 +247,17 @@ void Writeset_trx_dependency_tracker::get_dependency(THD *thd,
   if (can_use_writesets) {
     /*
      Check if adding this transaction exceeds the capacity of the writeset
-     history. If that happens, m_writeset_history will be cleared only after
-     using its information for current transaction.
+     history. If that happens, first try to make room by evicting the older
+     entries; only if that is not enough, m_writeset_history will be cleared
+     after using its information for current transaction.
     */
     exceeds_capacity =
         m_writeset_history.size() + writeset->size() > m_opt_max_history_size;
+    if (exceeds_capacity) {
+      evict_history(sequence_number);
+      exceeds_capacity = m_writeset_history.size() + writeset->size() >
+                         m_opt_max_history_size;
+    }
 
     /*
      Compute the greatest sequence_number among all conflicts and add the
@@ -292,6 +300,28 @@ void Writeset_trx_dependency_tracker::get_dependency(THD *thd,
   }
 }
 
+void Writeset_trx_dependency_tracker::evict_history(int64 sequence_number) {
+  /*
+    Drop the rows last changed by the older half of the transactions tracked
+    since m_writeset_history_start. Raising m_writeset_history_start to the
+    cutoff keeps the result safe: a transaction touching an evicted row gets at
+    least the cutoff as commit parent, which is not lower than the sequence
+    number the evicted entry held.
+  */
+  if (sequence_number <= m_writeset_history_start) return;
+  int64 cutoff = m_writeset_history_start +
+                 (sequence_number - m_writeset_history_start) / 2;
+
+  for (Writeset_history::iterator it = m_writeset_history.begin();
+       it != m_writeset_history.end();) {
+    if (it->second <= cutoff)
+      it = m_writeset_history.erase(it);
+    else
+      ++it;
+  }
+  m_writeset_history_start = cutoff;
+}
+
 void Writeset_trx_dependency_tracker::rotate(int64 start) {
   m_writeset_history_start = start;
   m_writeset_history.clear();
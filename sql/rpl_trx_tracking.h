@@ -140,6 +140,14 @@ class Writeset_trx_dependency_tracker {
   std::atomic<ulong> m_opt_max_history_size;
 
  private:
+  /**
+    Evict the history entries of the older half of the transactions tracked,
+    instead of clearing the whole history when it reaches its capacity.
+
+    @param [in] sequence_number sequence_number of the current transaction.
+  */
+  void evict_history(int64 sequence_number);
+
   /*
     Monitor the last transaction with write-set to use as the minimal
     commit parent when logical clock source is WRITE_SET, i.e., the most recent
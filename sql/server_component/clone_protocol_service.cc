@@ -393,9 +393,10 @@ DEFINE_METHOD(MYSQL *, mysql_clone_connect,
   mysql_options(mysql, MYSQL_OPT_CONNECT_TIMEOUT,
                 reinterpret_cast<char *>(&timeout));
 
-  /* Enable compression. */
+  /* Enable compression. Prefer zstd, which compresses data pages much
+  faster than zlib, and fall back to zlib if the donor does not allow it. */
   if (ssl_ctx->m_enable_compression) {
-    mysql_options(mysql, MYSQL_OPT_COMPRESS, nullptr);
+    mysql_options(mysql, MYSQL_OPT_COMPRESSION_ALGORITHMS, "zstd,zlib");
     mysql_extension_set_server_extn(mysql, ssl_ctx->m_server_extn);
   }
 
@@ -43,6 +43,7 @@
 class Field;
 class Filesort;
 class Item;
+class THD;
 struct TABLE;
 
 enum class Addon_fields_status {
@@ -308,6 +309,8 @@ class Sort_param {
   uint max_rows_per_buffer{0};  // Max (unpacked) rows / buffer.
   ha_rows max_rows{0};          // Select limit, or HA_POS_ERROR if unlimited.
   bool use_hash{false};         // Whether to use hash to distinguish cut JSON
+  uint max_sort_threads{1};     // Max threads for sorting one buffer.
+  const THD *thd{nullptr};      // Session to check for KILL while sorting.
   bool m_remove_duplicates{
       false};  ///< Whether we want to remove duplicate rows
 
@@ -456,7 +459,8 @@ class Sort_param {
   enum enum_sort_algorithm {
     FILESORT_ALG_NONE,
     FILESORT_ALG_STD_SORT,
-    FILESORT_ALG_STD_STABLE
+    FILESORT_ALG_STD_STABLE,
+    FILESORT_ALG_RADIX
   };
   enum_sort_algorithm m_sort_algorithm{FILESORT_ALG_NONE};
 
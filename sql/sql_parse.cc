@@ -2624,9 +2624,14 @@ done:
 
     The factor 5 is pretty much arbitrary, but ends up allowing three
     allocations (1 + 1.5 + 1.5²) under the current allocation policy.
+
+    Sessions that repeatedly run statements needing more memory than that
+    can raise query_prealloc_size to keep their memory between statements
+    instead of returning it to malloc every time.
   */
   constexpr size_t kPreallocSz = 40960;
-  if (thd->mem_root->allocated_size() < kPreallocSz)
+  if (thd->mem_root->allocated_size() <
+      std::max<size_t>(kPreallocSz, thd->variables.query_prealloc_size))
     thd->mem_root->ClearForReuse();
   else
     thd->mem_root->Clear();
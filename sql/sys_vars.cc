@@ -1527,6 +1527,15 @@ static Sys_var_uint Sys_binlog_transaction_compression_level_zstd(
     BLOCK_SIZE(1), NO_MUTEX_GUARD, NOT_IN_BINLOG,
     ON_CHECK(check_binlog_trx_compression), ON_UPDATE(nullptr));
 
+static Sys_var_ulong Sys_binlog_transaction_compression_min_size(
+    "binlog_transaction_compression_min_size",
+    "Transactions whose uncompressed size in the binary log is smaller than "
+    "this many bytes are not compressed, even when "
+    "binlog_transaction_compression is enabled.",
+    SESSION_VAR(binlog_trx_compression_min_size), CMD_LINE(REQUIRED_ARG),
+    VALID_RANGE(0, ULONG_MAX), DEFAULT(0), BLOCK_SIZE(1), NO_MUTEX_GUARD,
+    NOT_IN_BINLOG, ON_CHECK(check_binlog_trx_compression), ON_UPDATE(nullptr));
+
 static bool on_session_track_gtids_update(sys_var *, THD *thd, enum_var_type) {
   thd->session_tracker.get_tracker(SESSION_GTIDS_TRACKER)->update(thd);
   return false;
@@ -4055,6 +4064,16 @@ static Sys_var_uint Sys_eq_range_index_dive_limit(
     CMD_LINE(REQUIRED_ARG), VALID_RANGE(0, UINT_MAX32), DEFAULT(200),
     BLOCK_SIZE(1));
 
+static Sys_var_uint Sys_eq_range_index_dive_sample(
+    "eq_range_index_dive_sample",
+    "When eq_range_index_dive_limit is exceeded, do index dives for "
+    "about this many evenly spaced equality ranges and extrapolate the "
+    "row estimate of the remaining equality ranges from them. "
+    "If set to 0, index statistics are used for all of them.",
+    HINT_UPDATEABLE SESSION_VAR(eq_range_index_dive_sample),
+    CMD_LINE(REQUIRED_ARG), VALID_RANGE(0, UINT_MAX32), DEFAULT(0),
+    BLOCK_SIZE(1));
+
 static Sys_var_ulong Sys_range_alloc_block_size(
     "range_alloc_block_size",
     "Allocation block size for storing ranges during optimization",
@@ -4076,7 +4095,11 @@ static Sys_var_ulong Sys_query_alloc_block_size(
     ON_UPDATE(fix_thd_mem_root));
 
 static Sys_var_ulong Sys_query_prealloc_size(
-    "query_prealloc_size", "Persistent buffer for query parsing and execution",
+    "query_prealloc_size",
+    "Persistent buffer for query parsing and execution. After a statement, "
+    "the session keeps the last block of its statement memory for the next "
+    "statement if no more than max(this value, 40960) bytes were allocated, "
+    "and frees all of it otherwise",
     SESSION_VAR(query_prealloc_size), CMD_LINE(REQUIRED_ARG),
     VALID_RANGE(QUERY_ALLOC_PREALLOC_SIZE, ULONG_MAX),
     DEFAULT(QUERY_ALLOC_PREALLOC_SIZE), BLOCK_SIZE(1024), NO_MUTEX_GUARD,
@@ -5024,6 +5047,15 @@ static Sys_var_ulong Sys_sort_buffer(
     VALID_RANGE(MIN_SORT_MEMORY, ULONG_MAX), DEFAULT(DEFAULT_SORT_MEMORY),
     BLOCK_SIZE(1));
 
+static Sys_var_ulong Sys_filesort_max_threads(
+    "filesort_max_threads",
+    "Maximum number of threads a sort may use to sort one sort buffer. "
+    "The buffer is split into segments that are sorted concurrently and "
+    "then merged. Sorts of all sessions together use at most one helper "
+    "thread per CPU. 1 means the session thread sorts the buffer alone",
+    SESSION_VAR(filesort_max_threads), CMD_LINE(REQUIRED_ARG),
+    VALID_RANGE(1, 64), DEFAULT(1), BLOCK_SIZE(1));
+
 /**
   Check sql modes strict_mode, 'NO_ZERO_DATE', 'NO_ZERO_IN_DATE' and
   'ERROR_FOR_DIVISION_BY_ZERO' are used together. If only subset of it
@@ -5411,6 +5443,19 @@ static Sys_var_uint Sys_threadpool_oversubscribe(
     "How many additional active worker threads in a group are allowed.",
     GLOBAL_VAR(threadpool_oversubscribe), CMD_LINE(REQUIRED_ARG),
     VALID_RANGE(1, 1000), DEFAULT(3), BLOCK_SIZE(1));
+static Sys_var_bool Sys_threadpool_work_stealing(
+    "thread_pool_work_stealing",
+    "Let a worker thread that found no work in its own thread group take a "
+    "queued event from another group before going to sleep.",
+    GLOBAL_VAR(threadpool_work_stealing), CMD_LINE(OPT_ARG), DEFAULT(false));
+static Sys_var_uint Sys_threadpool_short_query_time(
+    "thread_pool_short_query_time",
+    "In the 'transactions' high priority mode, also put events of "
+    "connections whose previous request ran for less than this many "
+    "microseconds into the high priority queue, as long as they have high "
+    "priority tickets. 0 disables this.",
+    GLOBAL_VAR(threadpool_short_query_time), CMD_LINE(REQUIRED_ARG),
+    VALID_RANGE(0, UINT_MAX), DEFAULT(0), BLOCK_SIZE(1));
 static Sys_var_uint Sys_threadpool_size(
     "thread_pool_size",
     "Number of thread groups in the pool. "
@@ -412,6 +412,7 @@ struct System_variables {
   ulong auto_increment_increment, auto_increment_offset;
   ulong bulk_insert_buff_size;
   uint eq_range_index_dive_limit;
+  uint eq_range_index_dive_sample;
   uint cte_max_recursion_depth;
   ulonglong histogram_generation_max_mem_size;
   ulong join_buff_size;
@@ -440,6 +441,7 @@ struct System_variables {
   ulong read_rnd_buff_size;
   ulong div_precincrement;
   ulong sortbuff_size;
+  ulong filesort_max_threads;
   ulong max_sp_recursion_depth;
   ulong default_week_format;
   ulong max_seeks_for_key;
@@ -456,6 +458,7 @@ struct System_variables {
   bool binlog_trx_compression;
   ulong binlog_trx_compression_type;  // see enum_binlog_trx_compression
   uint binlog_trx_compression_level_zstd;
+  ulong binlog_trx_compression_min_size;
   ulonglong binlog_row_value_options;
   bool sql_log_bin;
   // see enum_transaction_write_set_hashing_algorithm
@@ -39,6 +39,8 @@ extern uint
     threadpool_stall_limit; /* time interval in 10 ms units for stall checks*/
 extern uint threadpool_max_threads;   /* Maximum threads in pool */
 extern uint threadpool_oversubscribe; /* Maximum active threads in group */
+extern bool threadpool_work_stealing; /* Idle workers take other groups' work */
+extern uint threadpool_short_query_time; /* Short requests get high priority */
 
 /* Possible values for thread_pool_high_prio_mode */
 extern const char *threadpool_high_prio_mode_names[];
@@ -70,6 +72,8 @@ extern int tp_get_idle_thread_count() noexcept;
 struct TP_STATISTICS {
   /* Current number of worker thread. */
   std::atomic<int32> num_worker_threads;
+  /* Number of events taken from the queue of another thread group. */
+  std::atomic<int64> num_stolen_events;
 };
 
 extern TP_STATISTICS tp_stats;
@@ -39,6 +39,8 @@ uint threadpool_size;
 uint threadpool_stall_limit;
 uint threadpool_max_threads;
 uint threadpool_oversubscribe;
+bool threadpool_work_stealing;
+uint threadpool_short_query_time;
 
 /* Stats */
 TP_STATISTICS tp_stats;
@@ -60,6 +60,15 @@ const char *threadpool_high_prio_mode_names[] = {"transactions", "statements",
 /** Indicates that threadpool was initialized*/
 static bool threadpool_started = false;
 
+/**
+  Set by tp_end() before the thread groups are closed, after which
+  steal_event() no longer looks at other groups.
+*/
+static std::atomic<bool> stealing_stopped{false};
+
+/** Number of workers currently looking at other groups in steal_event() */
+static std::atomic<int> stealing_threads{0};
+
 /*
   Define PSI Keys for performance schema.
   We have a mutex per group, worker threads, condition per worker thread,
@@ -116,6 +125,8 @@ struct connection_t {
   bool bound_to_poll_descriptor;
   bool waiting;
   uint tickets;
+  /* Duration of the last request, see thread_pool_short_query_time. */
+  ulonglong last_request_usec;
 };
 
 typedef I_P_List<connection_t,
@@ -384,7 +395,8 @@ inline bool too_many_busy_threads(const thread_group_t &thread_group) noexcept {
 /*
    Checks if a given connection is eligible to enter the high priority queue
    based on its current thread_pool_high_prio_mode value, available high
-   priority tickets and transactional state and whether any locks are held.
+   priority tickets and transactional state, whether any locks are held and,
+   if thread_pool_short_query_time is set, the duration of its last request.
 */
 
 inline bool connection_is_high_prio(const connection_t &c) noexcept {
@@ -392,7 +404,8 @@ inline bool connection_is_high_prio(const connection_t &c) noexcept {
 
   return (mode == TP_HIGH_PRIO_MODE_STATEMENTS) ||
          (mode == TP_HIGH_PRIO_MODE_TRANSACTIONS && c.tickets > 0 &&
-          (thd_is_transaction_active(c.thd) ||
+          (c.last_request_usec < threadpool_short_query_time ||
+           thd_is_transaction_active(c.thd) ||
            c.thd->variables.option_bits & OPTION_TABLE_LOCK ||
            c.thd->locked_tables_mode != LTM_NONE ||
            c.thd->mdl_context.has_locks() ||
@@ -994,6 +1007,83 @@ static void queue_put(thread_group_t *thread_group, connection_t *connection) {
   DBUG_VOID_RETURN;
 }
 
+/**
+  Take a queued event from another thread group.
+
+  Used by a worker that found no work in its own group, so that a group
+  whose workers are all busy does not build a queue while others idle.
+  Groups are tried in order starting after the worker's own group, and
+  only with a try-lock, so that stealing never waits on a busy group.
+
+  On success the worker is accounted as an active thread of the group it
+  stole from, so that wait_begin()/wait_end() for the connection and
+  too_many_active_threads() for that group stay consistent. The caller must
+  undo this with return_stolen_event() after handling the event.
+
+  @param thread_group - the group of the current worker, not locked
+  @param[out] stolen_from - group the event was taken from
+
+  @return connection with pending event, or NULL if none was found.
+*/
+
+static connection_t *steal_event(thread_group_t *thread_group,
+                                 thread_group_t **stolen_from) noexcept {
+  const uint own = thread_group - all_groups;
+  const uint count = group_count;
+
+  /*
+    The mutex of a closed group is destroyed. tp_end() sets stealing_stopped
+    and then waits for stealing_threads to drop to 0 before closing any group.
+  */
+  stealing_threads.fetch_add(1);
+  if (stealing_stopped.load()) {
+    stealing_threads.fetch_sub(1);
+    return nullptr;
+  }
+
+  for (uint i = 1; i < count; i++) {
+    thread_group_t *const group = &all_groups[(own + i) % count];
+    if (mysql_mutex_trylock(&group->mutex)) continue;
+
+    connection_t *connection = nullptr;
+    /*
+      Only steal work the group cannot currently do itself: if it has a
+      waiting thread, that thread is about to be (or could be) woken.
+    */
+    if (!group->shutdown && group->waiting_threads.is_empty() &&
+        !too_many_active_threads(*group))
+      connection = queue_get(group);
+
+    if (connection) {
+      group->active_thread_count++;
+      mysql_mutex_unlock(&group->mutex);
+      stealing_threads.fetch_sub(1);
+      tp_stats.num_stolen_events.fetch_add(1, std::memory_order_relaxed);
+      *stolen_from = group;
+      return connection;
+    }
+    mysql_mutex_unlock(&group->mutex);
+  }
+  stealing_threads.fetch_sub(1);
+  return nullptr;
+}
+
+/**
+  Move the accounting of a worker back to its own group after it handled
+  an event obtained by steal_event().
+*/
+
+static void return_stolen_event(thread_group_t *thread_group,
+                                thread_group_t *stolen_from) noexcept {
+  mysql_mutex_lock(&stolen_from->mutex);
+  stolen_from->active_thread_count--;
+  mysql_mutex_unlock(&stolen_from->mutex);
+
+  mysql_mutex_lock(&thread_group->mutex);
+  thread_group->active_thread_count++;
+  mysql_mutex_unlock(&thread_group->mutex);
+}
+
 /**
   Retrieve a connection with pending event.
 
@@ -1006,6 +1096,8 @@ static void queue_put(thread_group_t *thread_group, connection_t *connection) {
   @param current_thread - current worker thread
   @param thread_group - current thread group
   @param abstime - absolute wait timeout
+  @param[out] stolen_from - set to the group the event was taken from if it
+                            came from another group, see steal_event()
 
   @return
   connection with pending event.
@@ -1014,10 +1106,13 @@ static void queue_put(thread_group_t *thread_group, connection_t *connection) {
 
 static connection_t *get_event(worker_thread_t *current_thread,
                                thread_group_t *thread_group,
-                               struct timespec *abstime) {
+                               struct timespec *abstime,
+                               thread_group_t **stolen_from) {
   DBUG_ENTER("get_event");
   connection_t *connection = nullptr;
   int err = 0;
+  bool tried_stealing = false;
+  *stolen_from = nullptr;
 
   mysql_mutex_lock(&thread_group->mutex);
   assert(thread_group->active_thread_count >= 0);
@@ -1085,6 +1180,25 @@ static connection_t *get_event(worker_thread_t *current_thread,
       }
     }
 
+    /*
+      Before sleeping, look for queued work in the other groups, once per
+      sleep. Our own mutex is released meanwhile, so recheck our queue if
+      nothing was found.
+    */
+    if (threadpool_work_stealing && !tried_stealing && !oversubscribed &&
+        group_count > 1) {
+      tried_stealing = true;
+      mysql_mutex_unlock(&thread_group->mutex);
+      connection = steal_event(thread_group, stolen_from);
+      mysql_mutex_lock(&thread_group->mutex);
+      if (connection) {
+        /* The worker is active in the group it stole from meanwhile. */
+        thread_group->active_thread_count--;
+        break;
+      }
+      continue;
+    }
+
     /* And now, finally sleep */
     current_thread->woken = false; /* wake() sets this to true */
 
@@ -1114,6 +1228,7 @@ static connection_t *get_event(worker_thread_t *current_thread,
     }
 
     if (err) break;
+    tried_stealing = false;
   }
 
   thread_group->stalled = false;
@@ -1181,6 +1296,7 @@ static connection_t *alloc_connection(THD *thd) noexcept {
     connection->bound_to_poll_descriptor = false;
     connection->abs_wait_timeout = ULLONG_MAX;
     connection->tickets = 0;
+    connection->last_request_usec = ULLONG_MAX;
   }
   DBUG_RETURN(connection);
 }
@@ -1405,6 +1521,10 @@ static void handle_event(connection_t *connection) {
   if (!connection->logged_in) {
     err = threadpool_add_connection(connection->thd);
     connection->logged_in = true;
+  } else if (threadpool_short_query_time) {
+    const ulonglong start = my_micro_time();
+    err = threadpool_process_request(connection->thd);
+    connection->last_request_usec = my_micro_time() - start;
   } else {
     err = threadpool_process_request(connection->thd);
   }
@@ -1445,12 +1565,14 @@ static void *worker_main(void *param) {
   /* Run event loop */
   for (;;) {
     connection_t *connection;
+    thread_group_t *stolen_from;
     struct timespec ts;
     set_timespec(&ts, threadpool_idle_timeout);
-    connection = get_event(&this_thread, thread_group, &ts);
+    connection = get_event(&this_thread, thread_group, &ts, &stolen_from);
     if (!connection) break;
     this_thread.event_count++;
     handle_event(connection);
+    if (stolen_from) return_stolen_event(thread_group, stolen_from);
   }
 
   /* Thread shutdown: cleanup per-worker-thread structure. */
@@ -1467,6 +1589,7 @@ static void *worker_main(void *param) {
 bool tp_init() {
   DBUG_ENTER("tp_init");
   threadpool_started = true;
+  stealing_stopped.store(false);
 
   for (uint i = 0; i < array_elements(all_groups); i++) {
     thread_group_init(&all_groups[i], get_connection_attrib());
@@ -1494,6 +1617,11 @@ void tp_end() noexcept {
   if (!threadpool_started) DBUG_VOID_RETURN;
 
   stop_timer(&pool_timer);
+
+  /* Workers of a group still running may try to steal from one closed. */
+  stealing_stopped.store(true);
+  while (stealing_threads.load() > 0) my_sleep(1000);
+
   for (uint i = 0; i < array_elements(all_groups); i++) {
     thread_group_close(&all_groups[i]);
   }
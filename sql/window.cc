@@ -1387,6 +1387,7 @@ void Window::reset_execution_state(Reset_level level) {
       }  // else not allocated, empty result set
 
       m_tmp_pos.m_rowno = -1;
+      m_frame_buffer_cursor_rowno = -1;
       /*
         w.frame_buffer()->file->ha_reset();
         We could truncate the file here if it is not too expensive..? FIXME
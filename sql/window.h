@@ -312,6 +312,15 @@ class Window {
   */
   Frame_buffer_position m_tmp_pos;
 
+  /**
+    Execution state: the row number (in the partition) of the row which the
+    frame buffer's scan cursor is on, i.e. the row read by the last
+    ha_rnd_pos() or ha_rnd_next(), or -1 if not known. Writes append rows
+    without moving the cursor, so the row after it can be read with a single
+    ha_rnd_next() instead of repositioning first. See read_frame_buffer_row.
+  */
+  int64 m_frame_buffer_cursor_rowno{-1};
+
   /**
     See #m_tmp_pos
   */
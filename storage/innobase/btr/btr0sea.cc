@@ -72,6 +72,8 @@ static ib_mutex_t btr_search_enabled_mutex;
 ulong btr_ahi_parts = 8;
 ut::fast_modulo_t btr_ahi_parts_fast_modulo(8);
 
+ulong btr_search_min_hit_ratio = 0;
+
 #ifdef UNIV_SEARCH_PERF_STAT
 /** Number of successful adaptive hash index lookups */
 ulint btr_search_n_succ = 0;
@@ -387,6 +389,13 @@ btr_search_t *btr_search_info_create(mem_heap_t *heap) {
 
   info->last_hash_succ = false;
 
+  info->n_ahi_hits = 0;
+  info->n_ahi_misses = 0;
+  info->window_searches = 0;
+  info->window_hits = 0;
+  info->hash_disabled = false;
+  info->n_disabled_searches = 0;
+
 #ifdef UNIV_SEARCH_PERF_STAT
   info->n_hash_succ = 0;
   info->n_hash_fail = 0;
@@ -400,6 +409,40 @@ btr_search_t *btr_search_info_create(mem_heap_t *heap) {
   return info;
 }
 
+/** Accounts a hash search in the index, and disables the AHI for the index if
+too few of the searches in the last BTR_SEARCH_HIT_RATIO_WINDOW succeeded.
+The search is accounted as failed, btr_search_guess_on_hash() reverts that on
+success. NOTE that info is NOT protected by any semaphore.
+@param[in,out]  info    search info of the index */
+static void btr_search_account_hash_search(btr_search_t *info) {
+  info->n_ahi_misses.fetch_add(1, std::memory_order_relaxed);
+
+  const auto n_searches =
+      info->window_searches.fetch_add(1, std::memory_order_relaxed) + 1;
+
+  if (n_searches < BTR_SEARCH_HIT_RATIO_WINDOW) {
+    return;
+  }
+
+  info->window_searches.store(0, std::memory_order_relaxed);
+  const uint64_t n_hits =
+      info->window_hits.exchange(0, std::memory_order_relaxed);
+
+  const uint64_t min_ratio = btr_search_min_hit_ratio;
+
+  if (min_ratio == 0 || n_hits * 100 >= min_ratio * n_searches) {
+    return;
+  }
+
+  /* Stop using the AHI for this index. The pages already hashed are dropped
+  lazily, when they are modified or evicted, so that a write-heavy index stops
+  competing for the latch of its AHI partition. */
+  info->n_disabled_searches.store(0, std::memory_order_relaxed);
+  info->last_hash_succ = false;
+  info->n_hash_potential = 0;
+  info->hash_disabled.store(true, std::memory_order_relaxed);
+}
+
 /** Updates the search info of an index about hash successes. NOTE that info
 is NOT protected by any semaphore, to save CPU time! Do not assume its fields
 are consistent.
@@ -835,7 +878,8 @@ bool btr_search_guess_on_hash(const dtuple_t *tuple, ulint mode,
   /* Note that, for efficiency, the struct info may not be protected by
    any latch here! */
 
-  if (info->n_hash_potential == 0) {
+  if (info->n_hash_potential == 0 ||
+      info->hash_disabled.load(std::memory_order_relaxed)) {
     return false;
   }
 
@@ -882,6 +926,8 @@ bool btr_search_guess_on_hash(const dtuple_t *tuple, ulint mode,
   the cursor. */
   cursor->flag = BTR_CUR_HASH_FAIL;
 
+  btr_search_account_hash_search(info);
+
 #ifdef UNIV_SEARCH_PERF_STAT
   info->n_hash_fail++;
 #endif /* UNIV_SEARCH_PERF_STAT */
@@ -982,6 +1028,11 @@ bool btr_search_guess_on_hash(const dtuple_t *tuple, ulint mode,
   info->last_hash_succ = true;
   cursor->flag = BTR_CUR_HASH;
 
+  /* Revert the accounting of the search as failed done above. */
+  info->n_ahi_misses.fetch_sub(1, std::memory_order_relaxed);
+  info->n_ahi_hits.fetch_add(1, std::memory_order_relaxed);
+  info->window_hits.fetch_add(1, std::memory_order_relaxed);
+
 #ifdef UNIV_SEARCH_PERF_STAT
   /* Revert the accounting we did for the hash search failure that was prepared
   above. */
@@ -1620,7 +1671,8 @@ void btr_search_update_hash_on_move(buf_block_t *new_block, buf_block_t *block,
   and new block settings matching? And are the old block settings valuable
   enough to keep in cache? */
   if ((!new_block_index || new_block->ahi.prefix_info.load() == old_settings) &&
-      (recommended_settings == old_settings)) {
+      (recommended_settings == old_settings) &&
+      !index->search_info->hash_disabled.load(std::memory_order_relaxed)) {
     /* We need to set recommended prefix so it is used by the
     btr_search_build_page_hash_index method. Since we are holding X-latch on
     block->lock, no other thread can modify the recommendation. */
@@ -1633,6 +1685,22 @@ void btr_search_update_hash_on_move(buf_block_t *new_block, buf_block_t *block,
   }
 }
 
+/** Drops the AHI entries of a page instead of maintaining them, if the AHI
+was disabled for the page's index by btr_search_account_hash_search().
+@param[in,out]  block   index page, x-latched
+@param[in]      index   index for which the page is hashed
+@return true if the entries were dropped */
+static bool btr_search_drop_if_hash_disabled(buf_block_t *block,
+                                             const dict_index_t *index) {
+  if (!index->search_info->hash_disabled.load(std::memory_order_relaxed)) {
+    return false;
+  }
+
+  btr_search_drop_page_hash_index(block);
+
+  return true;
+}
+
 void btr_search_update_hash_on_delete(btr_cur_t *cursor) {
   if (cursor->index->disable_ahi || !btr_search_enabled) {
     return;
@@ -1649,6 +1717,10 @@ void btr_search_update_hash_on_delete(btr_cur_t *cursor) {
     return;
   }
 
+  if (btr_search_drop_if_hash_disabled(block, index)) {
+    return;
+  }
+
   ut_ad(block->page.id.space() == index->space);
   ut_a(index == cursor->index);
   ut_a(!dict_index_is_ibuf(index));
@@ -1705,6 +1777,10 @@ void btr_search_update_hash_node_on_insert(btr_cur_t *cursor) {
     return;
   }
 
+  if (btr_search_drop_if_hash_disabled(block, index)) {
+    return;
+  }
+
   ut_a(cursor->index == index);
   ut_a(!dict_index_is_ibuf(index));
 
@@ -1760,6 +1836,10 @@ void btr_search_update_hash_on_insert(btr_cur_t *cursor) {
     return;
   }
 
+  if (btr_search_drop_if_hash_disabled(block, index)) {
+    return;
+  }
+
   const auto x_latch_guard = create_scope_guard([&locked, index]() {
     if (locked) {
       btr_search_x_unlock(index);
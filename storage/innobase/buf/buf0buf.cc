@@ -73,6 +73,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include "buf0dump.h"
 #include "dict0dict.h"
 #include "log0recv.h"
+#include "os0numa.h"
 #include "os0thread-create.h"
 #include "page0zip.h"
 #include "srv0mon.h"
@@ -526,6 +527,7 @@ void buf_get_total_stat(
     tot_stat->n_pages_made_young += buf_stat->n_pages_made_young;
 
     tot_stat->n_pages_not_made_young += buf_stat->n_pages_not_made_young;
+    tot_stat->n_pages_ghost_hits += buf_stat->n_pages_ghost_hits;
     tot_stat->buf_lru_flush_page_count += buf_stat->buf_lru_flush_page_count;
   }
 }
@@ -916,7 +918,23 @@ bool buf_pool_t::allocate_chunk(ulonglong mem_size, buf_chunk_t *chunk,
     }
   }
 #ifdef HAVE_LIBNUMA
-  if (srv_numa_interleave) {
+  if (numa_node != ULINT_UNDEFINED) {
+    const auto low_level_info = ut::large_page_low_level_info(
+        chunk->mem, ut::fallback_to_normal_page_t{});
+    struct bitmask *numa_nodes = numa_allocate_nodemask();
+    numa_bitmask_setbit(numa_nodes, static_cast<unsigned int>(numa_node));
+    /* MPOL_PREFERRED rather than MPOL_BIND: should the node run out of
+    memory we would rather take remote frames than fail the allocation. */
+    int st = mbind(low_level_info.base_ptr, low_level_info.allocation_size,
+                   MPOL_PREFERRED, numa_nodes->maskp, numa_nodes->size,
+                   MPOL_MF_MOVE);
+    if (st != 0) {
+      ib::warn(ER_IB_MSG_54, low_level_info.base_ptr,
+               low_level_info.allocation_size, "MPOL_PREFERRED",
+               "MPOL_MF_MOVE", strerror(errno));
+    }
+    numa_bitmask_free(numa_nodes);
+  } else if (srv_numa_interleave) {
     const auto low_level_info = ut::large_page_low_level_info(
         chunk->mem, ut::fallback_to_normal_page_t{});
     struct bitmask *numa_nodes = numa_get_mems_allowed();
@@ -1258,6 +1276,23 @@ static void buf_pool_create(buf_pool_t *buf_pool, ulint buf_pool_size,
   setpriority(PRIO_PROCESS, (pid_t)syscall(SYS_gettid), -20);
 #endif /* UNIV_LINUX */
 
+  buf_pool->numa_node = ULINT_UNDEFINED;
+
+#ifdef HAVE_LIBNUMA
+  if (srv_numa_node_affinity && os_numa_available() != -1) {
+    buf_pool->numa_node = instance_no % os_numa_num_configured_nodes();
+
+    /* Run the initialisation on the node the chunks are bound to, so
+    that the first touch of the frames and of the block descriptors
+    happens there as well. */
+    if (os_numa_run_on_node(static_cast<int>(buf_pool->numa_node)) == -1) {
+      ib::warn() << "Failed to run buffer pool instance " << instance_no
+                 << " initialization on NUMA node " << buf_pool->numa_node
+                 << ": " << strerror(errno);
+    }
+  }
+#endif /* HAVE_LIBNUMA */
+
   ut_ad(buf_pool_size % srv_buf_pool_chunk_unit == 0);
 
   /* 1. Initialize general fields
@@ -1344,6 +1379,9 @@ static void buf_pool_create(buf_pool_t *buf_pool, ulint buf_pool_size,
 
     buf_pool->zip_hash = ut::new_<hash_table_t>(2 * buf_pool->curr_size);
 
+    buf_pool->LRU_ghost =
+        ut::new_withkey<buf_LRU_ghost_t>(UT_NEW_THIS_FILE_PSI_KEY);
+
     buf_pool->last_printout_time = std::chrono::steady_clock::now();
   }
   /* 2. Initialize flushing fields
@@ -1358,6 +1396,8 @@ static void buf_pool_create(buf_pool_t *buf_pool, ulint buf_pool_size,
   buf_pool->run_lru = os_event_create();
   os_event_set(buf_pool->run_lru);
 
+  buf_pool->lru_free_page_rate.store(0);
+
   buf_pool->watch = (buf_page_t *)ut::zalloc_withkey(
       UT_NEW_THIS_FILE_PSI_KEY, sizeof(*buf_pool->watch) * BUF_POOL_WATCH_SIZE);
   for (i = 0; i < BUF_POOL_WATCH_SIZE; i++) {
@@ -1461,6 +1501,7 @@ static void buf_pool_free_instance(buf_pool_t *buf_pool) {
   ha_clear(buf_pool->page_hash);
   ut::delete_(buf_pool->page_hash);
   ut::delete_(buf_pool->zip_hash);
+  ut::delete_(buf_pool->LRU_ghost);
 }
 
 /** Frees the buffer pool global data structures. */
@@ -3156,6 +3197,29 @@ void buf_page_make_old(buf_page_t *bpage) {
   mutex_exit(&buf_pool->LRU_list_mutex);
 }
 
+/** One in this many buffer pool page accesses of a thread is counted in
+buf_stat_per_index when innodb_sample_index_accesses is enabled. */
+static constexpr uint32_t BUF_ACCESS_SAMPLE_RATE = 64;
+
+/** Count a sampled access to an index page in buf_stat_per_index.
+@param[in]      block   buffer-fixed block that was accessed */
+static inline void buf_sample_index_access(const buf_block_t *block) {
+  static thread_local uint32_t n_accesses;
+
+  if (++n_accesses % BUF_ACCESS_SAMPLE_RATE != 0) {
+    return;
+  }
+
+  const byte *frame = block->frame;
+
+  if (!fil_page_index_page_check(frame)) {
+    return;
+  }
+
+  buf_stat_per_index->inc_accesses(
+      index_id_t(block->page.id.space(), btr_page_get_index_id(frame)));
+}
+
 /** Moves a page to the start of the buffer pool LRU list if it is too old.
 This high-level function can be used to prevent an important page from
 slipping out of the buffer pool. The page must be fixed to the buffer pool.
@@ -4392,6 +4456,10 @@ buf_block_t *Buf_fetch<T>::single_page() {
   of the hash_lock and not the block->mutex and block->lock. */
   buf_wait_for_read(block, m_trx);
 
+  if (srv_sample_index_accesses) {
+    buf_sample_index_access(block);
+  }
+
   /* Mark block as dirty if requested by caller. If not requested (false)
   then we avoid updating the dirty state of the block and retain the
   original one. This is reason why ?
@@ -5808,6 +5876,17 @@ bool buf_page_io_complete(buf_page_t *bpage, bool evict) {
 
           buf_page_print(frame, bpage->size, BUF_PAGE_PRINT_NO_CRASH);
 
+          if (recv_recovery_is_on() &&
+              bpage->get_space()->is_dblwr_bypassed()) {
+            /* The doublewrite buffer holds no copy of this page, the device
+            was trusted to never tear a page write. */
+            ib::error() << "Page " << bpage->id << " was written without the"
+                        << " doublewrite buffer because the device reported"
+                        << " atomic page writes, but it is torn. Restart with"
+                        << " innodb_doublewrite_atomic_bypass=OFF after"
+                        << " restoring the tablespace from a backup.";
+          }
+
           ib::info(ER_IB_MSG_82) << "It is also possible that your"
                                     " operating system has corrupted"
                                     " its own file cache and rebooting"
@@ -6541,6 +6620,8 @@ static void buf_stats_aggregate_pool_info(
   total_info->n_pending_flush_list += pool_info->n_pending_flush_list;
   total_info->n_pages_made_young += pool_info->n_pages_made_young;
   total_info->n_pages_not_made_young += pool_info->n_pages_not_made_young;
+  total_info->n_pages_ghost_hits += pool_info->n_pages_ghost_hits;
+  total_info->ghost_list_len += pool_info->ghost_list_len;
   total_info->n_pages_read += pool_info->n_pages_read;
   total_info->n_pages_created += pool_info->n_pages_created;
   total_info->n_pages_written += pool_info->n_pages_written;
@@ -6590,6 +6671,9 @@ void buf_stats_get_pool_info(
 
   pool_info->old_lru_len = buf_pool->LRU_old_len;
 
+  /* Dirty read, as for the list lengths above */
+  pool_info->ghost_list_len = buf_pool->LRU_ghost->size();
+
   pool_info->free_list_len = UT_LIST_GET_LEN(buf_pool->free);
 
   pool_info->flush_list_len = UT_LIST_GET_LEN(buf_pool->flush_list);
@@ -6618,6 +6702,8 @@ void buf_stats_get_pool_info(
 
   pool_info->n_pages_not_made_young = buf_pool->stat.n_pages_not_made_young;
 
+  pool_info->n_pages_ghost_hits = buf_pool->stat.n_pages_ghost_hits;
+
   pool_info->n_pages_read = buf_pool->stat.n_pages_read;
 
   pool_info->n_pages_created = buf_pool->stat.n_pages_created;
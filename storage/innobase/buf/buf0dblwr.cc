@@ -80,6 +80,8 @@ ulong n_files{1};
 
 ulong batch_size{};
 
+bool atomic_bypass{false};
+
 ulong n_pages{64};
 
 ulong g_mode{Mode::ON};
@@ -2524,10 +2526,12 @@ dberr_t dblwr::write(buf_flush_t flush_type, buf_page_t *bpage,
 
   if (srv_read_only_mode || fsp_is_system_temporary(space_id) ||
       !dblwr::is_enabled() || Double_write::s_instances == nullptr ||
-      mtr_t::s_logging.dblwr_disabled()) {
+      mtr_t::s_logging.dblwr_disabled() ||
+      bpage->get_space()->is_dblwr_bypassed()) {
     /* Skip the double-write buffer since it is not needed. Temporary
     tablespaces are never recovered, therefore we don't care about
-    torn writes. */
+    torn writes. Pages of files on devices with atomic page writes
+    can't be torn. */
     bpage->set_dblwr_batch_id(std::numeric_limits<uint16_t>::max());
     err = Double_write::write_to_datafile(bpage, sync, nullptr);
     if (err == DB_PAGE_IS_STALE || err == DB_TABLESPACE_DELETED) {
@@ -34,6 +34,9 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include <stdarg.h>
 #include <stdio.h>
 #include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 #include "buf0buf.h"
 #include "buf0dump.h"
@@ -372,11 +375,13 @@ normal client queries.
                                         srv_io_capacity IO ops.
 @param[in]      last_activity_count     activity count
 @param[in]      n_io                    number of IO ops done since buffer
-                                        pool load has started */
+                                        pool load has started
+@param[in]      io_capacity             number of IO ops per second allowed
+                                        when there is other activity */
 static inline void buf_load_throttle_if_needed(
     std::chrono::steady_clock::time_point *last_check_time,
-    ulint *last_activity_count, ulint n_io) {
-  if (n_io % srv_io_capacity < srv_io_capacity - 1) {
+    ulint *last_activity_count, ulint n_io, ulint io_capacity) {
+  if (n_io % io_capacity < io_capacity - 1) {
     return;
   }
 
@@ -387,7 +392,7 @@ static inline void buf_load_throttle_if_needed(
     return;
   }
 
-  /* srv_io_capacity IO operations have been performed by buffer pool
+  /* io_capacity IO operations have been performed by buffer pool
   load since the last time we were here. */
 
   /* If no other activity, then keep going without any delay. */
@@ -412,7 +417,7 @@ static inline void buf_load_throttle_if_needed(
      again.
   5. There has been more other activity and thus we enter here.
   6. Now last_check_time is recent and we sleep if necessary to prevent
-     more than srv_io_capacity IO operations per second.
+     more than io_capacity IO operations per second.
   The deficiency is that we could have slept at 3., but for this we
   would have to update last_check_time before the
   "cur_activity_count == *last_activity_count" check and calling
@@ -426,6 +431,130 @@ static inline void buf_load_throttle_if_needed(
   *last_activity_count = srv_get_activity_count();
 }
 
+/** State shared by the threads of one buffer pool load. */
+struct buf_load_ctx_t {
+  /** Constructor.
+  @param[in]    dump    sorted page ids to load
+  @param[in]    dump_n  number of elements in dump */
+  buf_load_ctx_t(const buf_dump_t *dump, ulint dump_n)
+      : dump(dump), dump_n(dump_n) {}
+
+  /** Update innodb_buffer_pool_load_status and the stage progress, every
+  32 MiB worth of pages. */
+  void report_progress() {
+    /* Pages have different sizes in different tablespaces, assume the
+    default one. */
+    static const ulint update_status_every_n_pages =
+        32 * 1024 * 1024 / UNIV_PAGE_SIZE;
+
+    const ulint done = n_done.load(std::memory_order_relaxed);
+
+    if (done < last_reported + update_status_every_n_pages) {
+      return;
+    }
+
+    last_reported = done;
+
+    buf_load_status(STATUS_VERBOSE, "Loaded " ULINTPF "/" ULINTPF " pages",
+                    done, dump_n);
+    mysql_stage_set_work_completed(stage_progress, done);
+  }
+
+  /** Sorted page ids to load */
+  const buf_dump_t *dump;
+
+  /** Number of elements in dump */
+  const ulint dump_n;
+
+  /** Share of innodb_io_capacity of each thread */
+  ulint io_capacity{1};
+
+  /** Number of pages for which a read was issued or which were skipped */
+  std::atomic<ulint> n_done{0};
+
+  /** Number of threads still loading */
+  std::atomic<ulint> n_running{0};
+
+  /** Set when a thread saw buf_load_abort_flag */
+  std::atomic<bool> aborted{false};
+
+  /** n_done at the last progress report, only used by the coordinator */
+  ulint last_reported{0};
+
+  /** Stage progress of the load, owned by the coordinator */
+  PSI_stage_progress *stage_progress{nullptr};
+};
+
+/** Issue the reads for a range of the sorted dump.
+@param[in,out]  ctx             load state
+@param[in]      begin           first element of ctx->dump to load
+@param[in]      end             one past the last element to load
+@param[in]      coordinator     true if this thread reports the progress of
+                                the whole load */
+static void buf_load_range(buf_load_ctx_t *ctx, ulint begin, ulint end,
+                           bool coordinator) {
+  const buf_dump_t *dump = ctx->dump;
+  std::chrono::steady_clock::time_point last_check_time;
+  ulint last_activity_cnt = 0;
+
+  /* Avoid calling the expensive fil_space_acquire_silent() for each
+  page within the same tablespace. dump[] is sorted by (space, page),
+  so all pages from a given tablespace are consecutive. */
+  space_id_t cur_space_id = BUF_DUMP_SPACE(dump[begin]);
+  fil_space_t *space = fil_space_acquire_silent(cur_space_id);
+  page_size_t page_size(space ? space->flags : 0);
+
+  for (ulint i = begin; i < end && !SHUTTING_DOWN(); i++) {
+    /* space_id for this iteration of the loop */
+    const space_id_t this_space_id = BUF_DUMP_SPACE(dump[i]);
+
+    if (this_space_id != cur_space_id) {
+      if (space != nullptr) {
+        fil_space_release(space);
+      }
+
+      cur_space_id = this_space_id;
+      space = fil_space_acquire_silent(cur_space_id);
+
+      if (space != nullptr) {
+        const page_size_t cur_page_size(space->flags);
+        page_size.copy_from(cur_page_size);
+      }
+    }
+
+    ctx->n_done.fetch_add(1, std::memory_order_relaxed);
+
+    if (space == nullptr) {
+      continue;
+    }
+
+    buf_read_page_background(page_id_t(this_space_id, BUF_DUMP_PAGE(dump[i])),
+                             page_size, true);
+
+    if (i % 64 == 63) {
+      os_aio_simulated_wake_handler_threads();
+    }
+
+    if (coordinator) {
+      ctx->report_progress();
+    }
+
+    if (buf_load_abort_flag || ctx->aborted.load()) {
+      ctx->aborted = true;
+      break;
+    }
+
+    buf_load_throttle_if_needed(&last_check_time, &last_activity_cnt,
+                                i - begin, ctx->io_capacity);
+  }
+
+  if (space != nullptr) {
+    fil_space_release(space);
+  }
+
+  ctx->n_running.fetch_sub(1);
+}
+
 /** Perform a buffer pool load from the file specified by
  innodb_buffer_pool_filename. If any errors occur then the value of
  innodb_buffer_pool_load_status will be set accordingly, see buf_load_status().
@@ -567,15 +696,15 @@ static void buf_load() {
     std::sort(dump, dump + dump_n);
   }
 
-  std::chrono::steady_clock::time_point last_check_time;
-  ulint last_activity_cnt = 0;
+  buf_load_ctx_t ctx(dump, dump_n);
 
-  /* Avoid calling the expensive fil_space_acquire_silent() for each
-  page within the same tablespace. dump[] is sorted by (space, page),
-  so all pages from a given tablespace are consecutive. */
-  space_id_t cur_space_id = BUF_DUMP_SPACE(dump[0]);
-  fil_space_t *space = fil_space_acquire_silent(cur_space_id);
-  page_size_t page_size(space ? space->flags : 0);
+  /* Do not start more threads than there are io_capacity units to share
+  between them, each one throttles itself on its own share. */
+  const ulint n_threads =
+      std::max<ulint>(1, std::min<ulint>({srv_buf_load_threads,
+                                          srv_io_capacity, dump_n}));
+
+  ctx.io_capacity = std::max<ulint>(1, srv_io_capacity / n_threads);
 
 #ifdef HAVE_PSI_STAGE_INTERFACE
   PSI_stage_progress *pfs_stage_progress =
@@ -585,73 +714,62 @@ static void buf_load() {
   mysql_stage_set_work_estimated(pfs_stage_progress, dump_n);
   mysql_stage_set_work_completed(pfs_stage_progress, 0);
 
-  for (i = 0; i < dump_n && !SHUTTING_DOWN(); i++) {
-    /* space_id for this iteration of the loop */
-    const space_id_t this_space_id = BUF_DUMP_SPACE(dump[i]);
-
-    if (this_space_id != cur_space_id) {
-      if (space != nullptr) {
-        fil_space_release(space);
-      }
-
-      cur_space_id = this_space_id;
-      space = fil_space_acquire_silent(cur_space_id);
+#ifdef HAVE_PSI_STAGE_INTERFACE
+  ctx.stage_progress = pfs_stage_progress;
+#endif /* HAVE_PSI_STAGE_INTERFACE */
 
-      if (space != nullptr) {
-        const page_size_t cur_page_size(space->flags);
-        page_size.copy_from(cur_page_size);
-      }
-    }
+  /* dump[] is sorted by (space, page): give each thread a contiguous range so
+  that the reads it issues stay sequential. This thread loads the first range
+  and reports the progress of all of them. */
+  const ulint range_n = (dump_n + n_threads - 1) / n_threads;
 
-    if (space == nullptr) {
-      continue;
-    }
+  std::vector<IB_thread> threads;
 
-    buf_read_page_background(page_id_t(this_space_id, BUF_DUMP_PAGE(dump[i])),
-                             page_size, true);
+  for (ulint t = 1; t < n_threads; ++t) {
+    const ulint begin = t * range_n;
+    const ulint end = std::min(begin + range_n, dump_n);
 
-    if (i % 64 == 63) {
-      os_aio_simulated_wake_handler_threads();
+    if (begin >= end) {
+      break;
     }
 
-    /* Update the progress every 32 MiB, which is every Nth page,
-    where N = 32*1024^2 / page_size. */
-    static const ulint update_status_every_n_mb = 32;
-    static const ulint update_status_every_n_pages =
-        update_status_every_n_mb * 1024 * 1024 / page_size.physical();
+    ctx.n_running.fetch_add(1);
 
-    if (i % update_status_every_n_pages == 0) {
-      buf_load_status(STATUS_VERBOSE, "Loaded " ULINTPF "/" ULINTPF " pages",
-                      i + 1, dump_n);
-      mysql_stage_set_work_completed(pfs_stage_progress, i);
-    }
+    auto thread = os_thread_create(buf_load_thread_key, t, buf_load_range,
+                                   &ctx, begin, end, false);
+    threads.push_back(thread);
+    thread.start();
+  }
 
-    if (buf_load_abort_flag) {
-      if (space != nullptr) {
-        fil_space_release(space);
-      }
-      buf_load_abort_flag = false;
-      ut::free(dump);
-      buf_load_status(STATUS_INFO, "Buffer pool(s) load aborted on request");
-      /* Premature end, set estimated = completed = i and
-      end the current stage event. */
-      mysql_stage_set_work_estimated(pfs_stage_progress, i);
-      mysql_stage_set_work_completed(pfs_stage_progress, i);
-#ifdef HAVE_PSI_STAGE_INTERFACE
-      mysql_end_stage();
-#endif /* HAVE_PSI_STAGE_INTERFACE */
-      return;
-    }
+  ctx.n_running.fetch_add(1);
+  buf_load_range(&ctx, 0, std::min(range_n, dump_n), true);
 
-    buf_load_throttle_if_needed(&last_check_time, &last_activity_cnt, i);
+  while (ctx.n_running.load() > 0) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ctx.report_progress();
   }
 
-  if (space != nullptr) {
-    fil_space_release(space);
+  for (auto &thread : threads) {
+    thread.join();
   }
 
   ut::free(dump);
 
+  if (ctx.aborted) {
+    [[maybe_unused]] const ulint n_done = ctx.n_done.load();
+
+    buf_load_abort_flag = false;
+    buf_load_status(STATUS_INFO, "Buffer pool(s) load aborted on request");
+    /* Premature end, set estimated = completed = n_done and
+    end the current stage event. */
+    mysql_stage_set_work_estimated(pfs_stage_progress, n_done);
+    mysql_stage_set_work_completed(pfs_stage_progress, n_done);
+#ifdef HAVE_PSI_STAGE_INTERFACE
+    mysql_end_stage();
+#endif /* HAVE_PSI_STAGE_INTERFACE */
+    return;
+  }
+
   ut_sprintf_timestamp(now);
 
   buf_load_status(STATUS_INFO, "Buffer pool(s) load completed at %s", now);
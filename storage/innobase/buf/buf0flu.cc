@@ -58,6 +58,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include "log0write.h"
 #include "my_compiler.h"
 #include "os0file.h"
+#include "os0numa.h"
 #include "os0thread-create.h"
 #include "page0page.h"
 #include "srv0mon.h"
@@ -223,6 +224,46 @@ static void buf_flush_page_coordinator_thread();
 /** Worker thread of page_cleaner. */
 static void buf_flush_page_cleaner_thread();
 
+/** Account the pages an LRU manager thread flushed or evicted, and refresh
+MONITOR_LRU_MANAGER_FREE_PAGE_RATE once the current measurement period of the
+thread is at least a second long.
+@param[in,out]  buf_pool        buffer pool instance of the thread
+@param[in]      n_freed         pages flushed or evicted by the last batch
+@param[in,out]  n_period_freed  pages flushed or evicted in this period
+@param[in,out]  period_start    start of the current measurement period */
+static void buf_lru_manager_update_free_rate(
+    buf_pool_t *buf_pool, ulint n_freed, ulint &n_period_freed,
+    std::chrono::steady_clock::time_point &period_start) {
+  if (n_freed > 0) {
+    MONITOR_INC_VALUE(MONITOR_LRU_MANAGER_FREE_PAGES, n_freed);
+  }
+
+  n_period_freed += n_freed;
+
+  const auto now = std::chrono::steady_clock::now();
+  const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+      now - period_start);
+
+  if (elapsed < std::chrono::seconds{1}) {
+    return;
+  }
+
+  buf_pool->lru_free_page_rate.store(n_period_freed * 1000 / elapsed.count(),
+                                     std::memory_order_relaxed);
+
+  n_period_freed = 0;
+  period_start = now;
+
+  ulint rate = 0;
+
+  for (ulint i = 0; i < srv_buf_pool_instances; ++i) {
+    rate += buf_pool_from_array(i)->lru_free_page_rate.load(
+        std::memory_order_relaxed);
+  }
+
+  MONITOR_SET(MONITOR_LRU_MANAGER_FREE_PAGE_RATE, rate);
+}
+
 /** LRU manager thread for performing LRU flushed and evictions for buffer pool
 free list refill. One thread is created for each buffer pool instance. */
 static void buf_lru_manager_thread(size_t buf_pool_instance);
@@ -3742,9 +3783,18 @@ static void buf_lru_manager_thread(size_t buf_pool_instance) {
 
   buf_pool_t *const buf_pool = buf_pool_from_array(buf_pool_instance);
 
+  if (buf_pool->numa_node != ULINT_UNDEFINED &&
+      os_numa_run_on_node(static_cast<int>(buf_pool->numa_node)) == -1) {
+    ib::warn() << "Failed to bind lru_manager thread " << buf_pool_instance
+               << " to NUMA node " << buf_pool->numa_node << ": "
+               << strerror(errno);
+  }
+
   std::chrono::milliseconds lru_sleep_time{1000};
   auto next_loop_time = std::chrono::steady_clock::now() + lru_sleep_time;
   ulint lru_n_flushed = 1;
+  auto rate_period_start = std::chrono::steady_clock::now();
+  ulint rate_period_freed = 0;
 
   /* On server shutdown, the LRU manager thread runs through cleanup
   phase to provide free pages for the master and purge threads.  */
@@ -3771,6 +3821,9 @@ static void buf_lru_manager_thread(size_t buf_pool_instance) {
           MONITOR_LRU_BATCH_FLUSH_TOTAL_PAGE, MONITOR_LRU_BATCH_FLUSH_COUNT,
           MONITOR_LRU_BATCH_FLUSH_PAGES, lru_n_flushed);
     }
+
+    buf_lru_manager_update_free_rate(buf_pool, lru_n_flushed,
+                                     rate_period_freed, rate_period_start);
   }
 }
 
@@ -1875,6 +1875,22 @@ void buf_LRU_add_block(buf_page_t *bpage, /*!< in: control block */
                                   added to the start, regardless of this
                                   parameter */
 {
+  buf_pool_t *buf_pool = buf_pool_from_bpage(bpage);
+
+  ut_ad(mutex_own(&buf_pool->LRU_list_mutex));
+
+  if (srv_LRU_ghost_list_size == 0) {
+    if (buf_pool->LRU_ghost->size() > 0) {
+      /* The ghost list was disabled at runtime */
+      buf_pool->LRU_ghost->trim(0);
+    }
+  } else if (old && buf_pool->LRU_ghost->remove(bpage->id)) {
+    /* The page was evicted recently and is needed again: it belongs to
+    the working set rather than to a scan. */
+    old = false;
+    buf_pool->stat.n_pages_ghost_hits++;
+  }
+
   buf_LRU_add_block_low(bpage, old);
 }
 
@@ -1988,6 +2004,14 @@ bool buf_LRU_free_page(buf_page_t *bpage, bool zip) {
   ut_ad(rw_lock_own(hash_lock, RW_LOCK_X));
   ut_ad(buf_page_can_relocate(bpage));
 
+  /* Remember the page if it is completely evicted. Pages read ahead but
+  never accessed are not worth remembering. */
+  if (srv_LRU_ghost_list_size > 0 && b == nullptr &&
+      buf_page_is_accessed(bpage) !=
+          std::chrono::steady_clock::time_point{}) {
+    buf_pool->LRU_ghost->insert(bpage->id, srv_LRU_ghost_list_size);
+  }
+
   if (!buf_LRU_block_remove_hashed(bpage, zip, false)) {
     mutex_exit(&buf_pool->LRU_list_mutex);
 
@@ -251,7 +251,7 @@ read_ahead:
 
     if (!ibuf_bitmap_page(cur_page_id, page_size)) {
       count += buf_read_page_low(&err, false, IORequest::DO_NOT_WAKE, ibuf_mode,
-                                 cur_page_id, page_size, false, trx, false);
+                                 cur_page_id, page_size, false, trx, true);
 
       if (err == DB_TABLESPACE_DELETED) {
         ib::warn(ER_IB_MSG_140) << "Random readahead trying to"
@@ -264,6 +264,10 @@ read_ahead:
     }
   }
 
+  /* The requests were buffered above, submit them with one io_submit()
+  per segment, also after a break out of the loop. */
+  os_aio_dispatch_read_array_submit();
+
   /* In simulated aio we wake the aio handler threads only after
   queuing all aio requests.  */
 
@@ -631,6 +631,8 @@ static const uint CLONE_DESC_FILE_FLAG_RENAMED = 4;
 static const uint CLONE_DESC_FILE_FLAG_DELETED = 5;
 /** Clone File Flag: File metadata has encryption key. */
 static const uint CLONE_DESC_FILE_HAS_KEY = 6;
+/** Clone File Flag: Compression type ZSTD*/
+static const uint CLONE_DESC_FILE_FLAG_ZSTD = 7;
 
 /** File Metadata: Tablespace ID in 4 bytes */
 static const uint CLONE_FILE_SPACE_ID_OFFSET = CLONE_FILE_FLAGS_OFFSET + 2;
@@ -697,6 +699,8 @@ void Clone_Desc_File_MetaData::serialize(byte *&desc_file, uint &len,
     DESC_SET_FLAG(file_flags, CLONE_DESC_FILE_FLAG_ZLIB);
   } else if (m_file_meta.m_compress_type == Compression::LZ4) {
     DESC_SET_FLAG(file_flags, CLONE_DESC_FILE_FLAG_LZ4);
+  } else if (m_file_meta.m_compress_type == Compression::ZSTD) {
+    DESC_SET_FLAG(file_flags, CLONE_DESC_FILE_FLAG_ZSTD);
   }
   /* Set file encryption type */
   if (m_file_meta.m_encryption_metadata.m_type == Encryption::AES) {
@@ -785,6 +789,8 @@ bool Clone_Desc_File_MetaData::deserialize(const byte *desc_file,
     m_file_meta.m_compress_type = Compression::ZLIB;
   } else if (DESC_CHECK_FLAG(file_flags, CLONE_DESC_FILE_FLAG_LZ4)) {
     m_file_meta.m_compress_type = Compression::LZ4;
+  } else if (DESC_CHECK_FLAG(file_flags, CLONE_DESC_FILE_FLAG_ZSTD)) {
+    m_file_meta.m_compress_type = Compression::ZSTD;
   }
 
   /* Get file encryption information */
@@ -33,6 +33,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include "rem/rec.h"
 #include "rem0rec.h"
 #include "row0log.h"
+#include "srv0srv.h"
 
 namespace ddl {
 
@@ -117,6 +118,8 @@ dberr_t File_reader::prepare() noexcept {
     return err;
   }
 
+  prefetch_next();
+
   /* Fetch and advance to the next record. */
   m_ptr = m_io_buffer.first;
 
@@ -135,6 +138,10 @@ dberr_t File_reader::seek(os_offset_t offset) noexcept {
 
   m_ptr = m_io_buffer.first;
 
+  if (err == DB_SUCCESS) {
+    prefetch_next();
+  }
+
   return err;
 }
 
@@ -311,4 +318,25 @@ dberr_t File_reader::next() noexcept {
   return len;
 }
 
+void File_reader::prefetch_next() const noexcept {
+#ifdef POSIX_FADV_WILLNEED
+  /* The file cache is bypassed with O_DIRECT, nothing to prefetch into. */
+  if (srv_disable_sort_file_cache) {
+    return;
+  }
+
+  const auto offset = m_offset + m_read_len;
+
+  if (offset >= m_size) {
+    return;
+  }
+
+  /* For encrypted files the next read may be shorter, reading ahead a
+  little more than needed is harmless. */
+  const auto len = std::min(os_offset_t{m_io_buffer.second}, m_size - offset);
+
+  posix_fadvise(m_file.get(), offset, len, POSIX_FADV_WILLNEED);
+#endif /* POSIX_FADV_WILLNEED */
+}
+
 }  // namespace ddl
@@ -1051,6 +1051,12 @@ void dict_move_to_mru(dict_table_t *table) /*!< in: table to move to MRU */
 
   ut_a(table->can_be_evicted);
 
+  /* Tables that are opened over and over again usually are already at
+  the MRU end; leave the list alone instead of relinking it */
+  if (UT_LIST_GET_FIRST(dict_sys->table_LRU) == table) {
+    return;
+  }
+
   UT_LIST_REMOVE(dict_sys->table_LRU, table);
 
   UT_LIST_ADD_FIRST(dict_sys->table_LRU, table);
@@ -1076,19 +1082,23 @@ dict_table_t *dict_table_open_on_name(
   DBUG_TRACE;
   DBUG_PRINT("dict_table_open_on_name", ("table: '%s'", table_name));
 
-  if (!dict_locked) {
-    dict_sys_mutex_enter();
-  }
-
   ut_ad(table_name);
-  ut_ad(dict_sys_mutex_own());
 
+  /* Build the lookup name before acquiring dict_sys->mutex, that every
+  table open goes through. */
   std::string table_str(table_name);
   /* Check and convert 5.7 table name. We always keep 8.0 format name in cache
   during upgrade. */
   if (dict_name::is_partition(table_name)) {
     dict_name::rebuild(table_str);
   }
+
+  if (!dict_locked) {
+    dict_sys_mutex_enter();
+  }
+
+  ut_ad(dict_sys_mutex_own());
+
   table = dict_table_check_if_in_cache_low(table_str.c_str());
 
   if (table == nullptr) {
@@ -144,6 +144,8 @@ data:  b,b,b,b,b,b,g,g,j,j,j, x, y
 then we would store 5,7,10,11,12 in the array. */
 typedef std::vector<uint64_t, ut::allocator<uint64_t>> boundaries_t;
 
+std::atomic<uint64_t> dict_stats_n_pages_sampled{0};
+
 /** Allocator type used for index_map_t. */
 typedef ut::allocator<std::pair<const char *const, dict_index_t *>>
     index_map_t_allocator;
@@ -909,6 +911,8 @@ static bool dict_stats_analyze_index_level(
     if (rec_is_last_on_page) {
       (*total_pages)++;
 
+      dict_stats_n_pages_sampled.fetch_add(1, std::memory_order_relaxed);
+
       if (level != 0 && (*total_pages) % 100 == 0 &&
           dict_stats_index_long_waiters(index, wait_start_time)) {
         /* long waiters exist. abort. */
@@ -1295,6 +1299,8 @@ static void dict_stats_analyze_index_below_cur(const btr_cur_t *cur,
                              nullptr /* no guessed block */, Page_fetch::NORMAL,
                              UT_LOCATION_HERE, &mtr);
 
+    dict_stats_n_pages_sampled.fetch_add(1, std::memory_order_relaxed);
+
     page = buf_block_get_frame(block);
 
     if (btr_page_get_level(page) == 0) {
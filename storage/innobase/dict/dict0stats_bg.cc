@@ -257,18 +257,19 @@ void dict_stats_thread_deinit() {
 
 /** Get the first table that has been added for auto recalc and eventually
 update its stats.
-@param[in,out]  thd     current thread */
-static void dict_stats_process_entry_from_recalc_pool(THD *thd) {
+@param[in,out]  thd     current thread
+@return number of index pages sampled */
+static uint64_t dict_stats_process_entry_from_recalc_pool(THD *thd) {
   table_id_t table_id;
 
   ut_ad(!srv_read_only_mode);
 
-  DBUG_EXECUTE_IF("do_not_meta_lock_in_background", return;);
+  DBUG_EXECUTE_IF("do_not_meta_lock_in_background", return 0;);
 
   /* pop the first table from the auto recalc pool */
   if (!dict_stats_recalc_pool_get(&table_id)) {
     /* no tables for auto recalc */
-    return;
+    return 0;
   }
 
   dict_table_t *table;
@@ -284,14 +285,14 @@ static void dict_stats_process_entry_from_recalc_pool(THD *thd) {
     /* table does not exist, must have been DROPped
     after its id was enqueued */
     dict_sys_mutex_exit();
-    return;
+    return 0;
   }
 
   /* Check whether table is corrupted */
   if (table->is_corrupted()) {
     dd_table_close(table, thd, &mdl, true);
     dict_sys_mutex_exit();
-    return;
+    return 0;
   }
 
   /* Set bg flag. */
@@ -306,6 +307,8 @@ static void dict_stats_process_entry_from_recalc_pool(THD *thd) {
   be replaced with something else, though a time interval is the natural
   approach. */
 
+  uint64_t n_pages = 0;
+
   if (std::chrono::steady_clock::now() - table->stats_last_recalc <
       MIN_RECALC_INTERVAL) {
     /* Stats were (re)calculated not long ago. To avoid
@@ -315,7 +318,14 @@ static void dict_stats_process_entry_from_recalc_pool(THD *thd) {
     dict_stats_recalc_pool_add(table);
 
   } else {
+    n_pages = dict_stats_n_pages_sampled.load(std::memory_order_relaxed);
+
     dict_stats_update(table, DICT_STATS_RECALC_PERSISTENT);
+
+    /* Includes the pages sampled by a concurrent ANALYZE TABLE, which
+    only errs on the side of pausing longer. */
+    n_pages =
+        dict_stats_n_pages_sampled.load(std::memory_order_relaxed) - n_pages;
   }
 
   dict_sys_mutex_enter();
@@ -328,6 +338,28 @@ static void dict_stats_process_entry_from_recalc_pool(THD *thd) {
   /* This call can't be moved into dict_sys->mutex protection,
   since it'll cause deadlock while release mdl lock. */
   dd_table_close(table, thd, &mdl, false);
+
+  return n_pages;
+}
+
+/** Pause the stats thread long enough to keep the pages sampled by the
+automatic recalculation within innodb_stats_auto_recalc_pages_per_second.
+@param[in]      n_pages         pages sampled by the last recalculation */
+static void dict_stats_throttle(uint64_t n_pages) {
+  const auto rate = srv_stats_auto_recalc_pages_per_sec;
+
+  if (rate == 0 || n_pages == 0) {
+    return;
+  }
+
+  const auto deadline = std::chrono::steady_clock::now() +
+                        std::chrono::milliseconds{n_pages * 1000 / rate};
+
+  /* dict_stats_event is set whenever a table is queued, it cannot be used
+  to wait here. Sleep in short steps to notice a shutdown. */
+  while (!SHUTTING_DOWN() && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+  }
 }
 
 #ifdef UNIV_DEBUG
@@ -378,9 +410,11 @@ void dict_stats_thread() {
       break;
     }
 
-    dict_stats_process_entry_from_recalc_pool(thd);
+    const auto n_pages = dict_stats_process_entry_from_recalc_pool(thd);
 
     os_event_reset(dict_stats_event);
+
+    dict_stats_throttle(n_pages);
   }
 
   destroy_internal_thd(thd);
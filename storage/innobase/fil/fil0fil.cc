@@ -39,6 +39,7 @@ The tablespace memory cache */
 #include "arch0page.h"
 #include "btr0btr.h"
 #include "buf0buf.h"
+#include "buf0dblwr.h"
 #include "buf0flu.h"
 #include "dict0boot.h"
 #include "dict0dd.h"
@@ -2689,6 +2690,47 @@ size_t Fil_system::get_minimum_limit_for_open_files(
   return result;
 }
 
+/** Decide whether page writes to a data file are atomic on the device, so
+that the doublewrite buffer can be bypassed for its tablespace, and record the
+decision in the file and the tablespace. Only single file tablespaces that are
+recovered from the redo log qualify.
+
+The decision is kept in memory only and taken again on every open, also
+during recovery. Nothing on disk tells recovery that pages were written
+without a doublewrite copy: if the device no longer reports atomic writes
+after a restart, a torn page of the file is reported as an ordinary
+corruption.
+@param[in,out]  file    file that was just opened */
+static void fil_node_check_atomic_page_write(fil_node_t *file) {
+  fil_space_t *space = file->space;
+
+  file->atomic_page_write = false;
+
+  if (dblwr::atomic_bypass && !srv_read_only_mode &&
+      space->purpose == FIL_TYPE_TABLESPACE &&
+      !fsp_is_system_or_temp_tablespace(space->id) &&
+      space->files.size() == 1) {
+    const page_size_t page_size(space->flags);
+
+    file->atomic_page_write =
+        os_file_atomic_write_supported(file->handle, page_size.physical());
+  }
+
+  if (file->atomic_page_write != space->m_atomic_page_writes.load()) {
+    if (file->atomic_page_write) {
+      ib::info() << "Page writes to '" << file->name << "' are atomic on the"
+                 << " device, skipping the doublewrite buffer for tablespace "
+                 << space->name;
+    } else {
+      ib::warn() << "Page writes to '" << file->name << "' are no longer"
+                 << " atomic on the device, using the doublewrite buffer for"
+                 << " tablespace " << space->name;
+    }
+  }
+
+  space->set_atomic_page_writes(file->atomic_page_write);
+}
+
 bool Fil_shard::open_file(fil_node_t *file) {
   bool success;
   fil_space_t *space = file->space;
@@ -2908,12 +2950,16 @@ bool Fil_shard::open_file(fil_node_t *file) {
               fil_system->get_open_files_limit());
         }
 
-        /* Flush tablespaces so that we can close modified files in the LRU
-        list. */
-        fil_system->flush_file_spaces();
-
+        /* Closing a file that is already flushed needs no I/O. Only when
+        every closable file in the LRU lists has unflushed changes, flush the
+        tablespaces so that we can close modified files in the LRU list.
+        Flushing first would fsync() every modified file on each open. */
         if (!fil_system->close_file_in_all_LRU()) {
-          fil_system->wait_while_ios_in_progress();
+          fil_system->flush_file_spaces();
+
+          if (!fil_system->close_file_in_all_LRU()) {
+            fil_system->wait_while_ios_in_progress();
+          }
         }
         mutex_acquire();
         continue;
@@ -2981,6 +3027,7 @@ bool Fil_shard::open_file(fil_node_t *file) {
   }
 
   if (success) {
+    fil_node_check_atomic_page_write(file);
     add_to_lru_if_needed(file);
     /* The file is ready for IO. */
     file->is_open = true;
@@ -3695,10 +3742,15 @@ bool Fil_system::set_open_files_limit(size_t &new_max_open_files) {
       new_max_open_files = current_n_files_open;
       return false;
     }
+    if (fil_system->close_file_in_all_LRU()) {
+      /* We closed some file, loop again to re-evaluate situation. */
+      continue;
+    }
+
+    /* Only flushed files can be closed. */
     fil_system->flush_file_spaces();
 
     if (fil_system->close_file_in_all_LRU()) {
-      /* We closed some file, loop again to re-evaluate situation. */
       continue;
     }
     wait_while_ios_in_progress();
@@ -7903,6 +7955,14 @@ dberr_t Fil_shard::do_io(const IORequest &type, bool sync,
     req_type.clear_compressed();
   }
 
+  /* Full page writes to a file on a device with untorn page writes are
+  issued atomically, the doublewrite buffer may have been skipped for them. */
+  if (req_type.is_write() && file->atomic_page_write &&
+      !req_type.punch_hole() && byte_offset == 0 &&
+      len == page_size.physical()) {
+    req_type.set_atomic_write();
+  }
+
   if (page_size.is_compressed()) {
     ut_ad(page_size.physical() > 0);
   }
@@ -8928,6 +8988,7 @@ dberr_t fil_set_compression(space_id_t space_id, const char *algorithm) {
     /* This is a Debug tool for setting compression on all
     compressible tables not otherwise specified. */
     switch (srv_debug_compress) {
+      case Compression::ZSTD:
       case Compression::LZ4:
       case Compression::ZLIB:
       case Compression::NONE:
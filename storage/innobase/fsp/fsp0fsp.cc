@@ -1360,6 +1360,23 @@ static UNIV_COLD ulint fsp_try_extend_data_file(fil_space_t *space,
   } else if (fsp_is_global_temporary(space->id)) {
     size_increase = srv_tmp_space.get_increment();
 
+  } else if (srv_session_temp_extend_increment > 0 &&
+             fsp_is_session_temporary(space->id)) {
+    /* Grow session temporary tablespaces in large steps, so that a big
+    sort or intrinsic table does not stall on many small extensions. */
+    const page_no_t extent_pages = fsp_get_extent_size_in_pages(page_size);
+
+    size_increase = static_cast<page_no_t>(
+        srv_session_temp_extend_increment *
+        ((1024 * 1024) / page_size.physical()));
+
+    size_increase = ut_calc_align(size_increase, extent_pages);
+
+    /* Keep the file size a multiple of the extent size */
+    if (size % extent_pages > 0) {
+      size_increase -= size % extent_pages;
+    }
+
   } else {
     /* Check if the tablespace supports autoextend_size */
     page_no_t autoextend_size_pages =
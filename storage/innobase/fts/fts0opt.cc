@@ -2514,6 +2514,13 @@ void fts_optimize_request_sync_table(dict_table_t *table) {
     return;
   }
 
+  /* Writers keep asking while the cache stays above the limits, one
+  queued request per table is enough. The flag is cleared when the request
+  is dequeued, see fts_optimize_sync_table(). */
+  if (table->fts->cache->sync->sync_requested.exchange(true)) {
+    return;
+  }
+
   msg = fts_optimize_create_msg(FTS_MSG_SYNC_TABLE, nullptr);
 
   table_id =
@@ -2791,6 +2798,12 @@ void fts_optimize_sync_table(table_id_t table_id) {
 
   if (table) {
     if (dict_table_has_fts_index(table) && table->fts->cache) {
+      /* Let writers queue a new request even if the sync below is skipped
+      because another one is running or the table is discarded. A table
+      that can't be opened is being dropped, evicted or is corrupted, and
+      its cache is not synced either way. */
+      table->fts->cache->sync->sync_requested.store(false);
+
       fts_sync_table(table, true, false, true);
     }
 
@@ -32,10 +32,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 
 #include <cmath>
 #include "page0cur.h"
-
-namespace dd {
-class Spatial_reference_system;
-}
+#include "sql/dd/types/spatial_reference_system.h"
 
 /** Copy mbr of dimension n_dim from src to dst. */
 inline static void copy_coords(double *dst,       /*!< in/out: destination. */
@@ -239,6 +236,21 @@ bool rtree_key_cmp(page_cur_mode_t mode, const uchar *a, int a_len,
   x.ymax = mach_double_read(a + dim_len + sizeof(double));
   y.ymax = mach_double_read(b + dim_len + sizeof(double));
 
+  /* In a Cartesian SRS, box intersection is a plain comparison of the
+  coordinates, exactly what bg::intersects() and bg::disjoint() do for
+  two boxes. Evaluate it here instead of building gis:: box objects and
+  dispatching through the functors for every record of a search. */
+  if (srs == nullptr || srs->is_cartesian()) {
+    const bool disjoint = x.xmax < y.xmin || x.xmin > y.xmax ||
+                          x.ymax < y.ymin || x.ymin > y.ymax;
+
+    if (mode == PAGE_CUR_INTERSECT) {
+      return (!disjoint);
+    } else if (mode == PAGE_CUR_DISJOINT) {
+      return (disjoint);
+    }
+  }
+
   switch (mode) {
     case PAGE_CUR_INTERSECT:
       return (mbr_intersect_cmp(srs, &x, &y));
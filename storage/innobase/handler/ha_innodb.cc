@@ -90,6 +90,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include "buf0dump.h"
 #include "buf0flu.h"
 #include "buf0lru.h"
+#include "buf0rea.h"
 #include "buf0stats.h"
 #include "clone0api.h"
 #include "clone0clone.h"
@@ -455,9 +456,9 @@ static void trx_deregister_from_2pc(trx_t *trx);
 static ulong innodb_default_row_format = DEFAULT_ROW_FORMAT_DYNAMIC;
 
 #ifdef UNIV_DEBUG
-/** Values for --innodb-debug-compress names. */
+/** Values for --innodb-debug-compress names, in Compression::Type order. */
 static const char *innodb_debug_compress_names[] = {"none", "zlib", "lz4",
-                                                    "lz4hc", NullS};
+                                                    "zstd", NullS};
 
 /** Enumeration of --innodb-debug-compress */
 static TYPELIB innodb_debug_compress_typelib = {
@@ -851,6 +852,7 @@ static PSI_thread_info all_innodb_threads[] = {
                    PSI_DOCUMENT_ME),
     PSI_THREAD_KEY(buf_dump_thread, "ib_buf_dump", PSI_FLAG_SINGLETON, 0,
                    PSI_DOCUMENT_ME),
+    PSI_THREAD_KEY(buf_load_thread, "ib_buf_load", 0, 0, PSI_DOCUMENT_ME),
     PSI_THREAD_KEY(clone_ddl_thread, "ib_clone_ddl", PSI_FLAG_SINGLETON, 0,
                    PSI_DOCUMENT_ME),
     PSI_THREAD_KEY(clone_gtid_thread, "ib_clone_gtid", PSI_FLAG_SINGLETON, 0,
@@ -904,6 +906,7 @@ static PSI_thread_info all_innodb_threads[] = {
     PSI_THREAD_KEY(parallel_read_thread, "ib_par_rd", 0, 0, PSI_DOCUMENT_ME),
     PSI_THREAD_KEY(parallel_rseg_init_thread, "ib_par_rseg", 0, 0,
                    PSI_DOCUMENT_ME),
+    PSI_THREAD_KEY(recv_apply_thread, "ib_recv_apply", 0, 0, PSI_DOCUMENT_ME),
     PSI_THREAD_KEY(meb::redo_log_archive_consumer_thread, "ib_meb_rl",
                    PSI_FLAG_SINGLETON, 0, PSI_DOCUMENT_ME)};
 #endif /* UNIV_PFS_THREAD */
@@ -1181,6 +1184,15 @@ static MYSQL_THDVAR_BOOL(ft_ignore_stopwords, PLUGIN_VAR_OPCMDARG,
                          "Instruct FTS to ignore stopwords.", nullptr, nullptr,
                          false);
 
+static MYSQL_THDVAR_BOOL(
+    sorted_bulk_insert, PLUGIN_VAR_OPCMDARG,
+    "Buffer the rows of INSERT ... SELECT, multi-row INSERT and LOAD DATA "
+    "statements up to innodb_sort_buffer_size bytes and insert them in "
+    "primary key order. Statements that ignore or replace duplicates, or "
+    "whose table has triggers, foreign keys, FULLTEXT indexes, BLOB columns "
+    "or an AUTO_INCREMENT column, insert in statement order.",
+    nullptr, nullptr, false);
+
 static MYSQL_THDVAR_ULONG(parallel_read_threads, PLUGIN_VAR_RQCMDARG,
                           "Number of threads to do parallel read.", nullptr,
                           nullptr, 4,                   /* Default. */
@@ -2810,6 +2822,9 @@ dberr_t Compression::check(const char *algorithm, Compression *compression) {
   } else if (innobase_strcasecmp(algorithm, "lz4") == 0) {
     compression->m_type = LZ4;
 
+  } else if (innobase_strcasecmp(algorithm, "zstd") == 0) {
+    compression->m_type = ZSTD;
+
   } else {
     return (DB_UNSUPPORTED);
   }
@@ -2833,6 +2848,7 @@ bool Compression::validate(const Compression::Type type) {
     case NONE:
     case ZLIB:
     case LZ4:
+    case ZSTD:
       break;
     default:
       ret = false;
@@ -8196,6 +8212,8 @@ int ha_innobase::close() {
 
   free_share_and_nullify(&m_share);
 
+  bulk_insert_free();
+
   row_prebuilt_free(m_prebuilt, false);
 
   if (m_upd_buf != nullptr) {
@@ -9534,10 +9552,176 @@ void innobase_get_multi_value(const TABLE *mysql_table, ulint f_idx,
   ut_ad(succ);
 }
 
+/** Compare two rows in MySQL format on the primary key of a table.
+@param[in]      key     primary key of the table
+@param[in]      a       row in MySQL format
+@param[in]      b       row in MySQL format
+@return negative, 0 or positive if a is smaller, equal or greater than b */
+static int innobase_pk_rec_cmp(const KEY *key, const uchar *a,
+                               const uchar *b) {
+  for (uint i = 0; i < key->user_defined_key_parts; i++) {
+    const KEY_PART_INFO *key_part = &key->key_part[i];
+    const Field *field = key_part->field;
+    const uint offset = get_field_offset(key->table, field);
+
+    /* Primary key columns are NOT NULL in InnoDB. */
+    ut_ad(!field->is_nullable());
+
+    const int result =
+        field->cmp_max(a + offset, b + offset, key_part->length);
+
+    if (result != 0) {
+      return (key_part->key_part_flag & HA_REVERSE_SORT) ? -result : result;
+    }
+  }
+
+  return 0;
+}
+
+/** Start buffering the rows of an INSERT or LOAD DATA statement so that they
+can be inserted in primary key order, see innodb_sorted_bulk_insert.
+@param[in]      rows    estimated number of rows, 0 if unknown */
+void ha_innobase::start_bulk_insert(ha_rows rows) {
+  DBUG_TRACE;
+
+  ut_ad(m_bulk_heap == nullptr);
+
+  THD *thd = ha_thd();
+
+  if (!THDVAR(thd, sorted_bulk_insert) || rows == 1) {
+    return;
+  }
+
+  switch (thd_sql_command(thd)) {
+    case SQLCOM_INSERT:
+    case SQLCOM_INSERT_SELECT:
+    case SQLCOM_LOAD:
+    case SQLCOM_CREATE_TABLE:
+      break;
+    default:
+      return;
+  }
+
+  dict_table_t *ib_table = m_prebuilt->table;
+
+  /* Keep the statement order whenever it can be observed: the row that
+  is ignored or replaced on a duplicate, the generated AUTO_INCREMENT
+  values, triggers and foreign key checks. BLOB values point into
+  buffers that are reused for the next row, and without a user defined
+  primary key there is no order to sort on. Partitions switch the
+  prebuilt struct per row and are not buffered. */
+  if (table->part_info != nullptr || m_ignore_dup_key ||
+      m_prebuilt->allow_duplicates() ||
+      m_prebuilt->clust_index_was_generated ||
+      table->s->primary_key == MAX_KEY || table->s->blob_fields > 0 ||
+      table->found_next_number_field != nullptr ||
+      table->triggers != nullptr || ib_table->is_intrinsic() ||
+      dict_table_has_fts_index(ib_table) || !ib_table->foreign_set.empty() ||
+      !ib_table->referenced_set.empty()) {
+    return;
+  }
+
+  m_bulk_heap = mem_heap_create(UNIV_PAGE_SIZE, UT_LOCATION_HERE);
+}
+
+/** Add a row to the sorted bulk insert buffer, and insert the buffered rows
+once the buffer is full.
+@param[in,out]  record  row in MySQL format, table->record[0]
+@return error number or 0 */
+int ha_innobase::bulk_insert_buffer_row(uchar *record) {
+  const size_t len = table->s->reclength;
+
+  auto row = static_cast<uchar *>(mem_heap_dup(m_bulk_heap, record, len));
+
+  m_bulk_rows.push_back(row);
+
+  if (mem_heap_get_size(m_bulk_heap) < srv_sort_buf_size) {
+    return 0;
+  }
+
+  const int error = bulk_insert_flush();
+
+  if (error == 0) {
+    /* The binary log is written from table->record[0] after write_row()
+    returns, it must still hold the row of the caller. On failure it
+    holds the row that could not be inserted, for the error message. */
+    memcpy(record, row, len);
+  }
+
+  mem_heap_empty(m_bulk_heap);
+
+  return error;
+}
+
+/** Insert the rows of the sorted bulk insert buffer in primary key order.
+The buffer memory is not released.
+@return error number or 0 */
+int ha_innobase::bulk_insert_flush() {
+  if (m_bulk_rows.empty()) {
+    return 0;
+  }
+
+  const KEY *key = &table->key_info[table->s->primary_key];
+
+  std::stable_sort(m_bulk_rows.begin(), m_bulk_rows.end(),
+                   [key](const uchar *a, const uchar *b) {
+                     return innobase_pk_rec_cmp(key, a, b) < 0;
+                   });
+
+  int error = 0;
+
+  m_bulk_flushing = true;
+
+  for (const uchar *row : m_bulk_rows) {
+    memcpy(table->record[0], row, table->s->reclength);
+
+    error = write_row(table->record[0]);
+
+    if (error != 0) {
+      break;
+    }
+  }
+
+  m_bulk_flushing = false;
+
+  m_bulk_rows.clear();
+
+  return error;
+}
+
+/** Discard the sorted bulk insert buffer. */
+void ha_innobase::bulk_insert_free() {
+  if (m_bulk_heap != nullptr) {
+    mem_heap_free(m_bulk_heap);
+    m_bulk_heap = nullptr;
+  }
+
+  m_bulk_rows.clear();
+}
+
+/** Insert the rows still buffered since start_bulk_insert().
+@return error number or 0 */
+int ha_innobase::end_bulk_insert() {
+  DBUG_TRACE;
+
+  if (m_bulk_heap == nullptr) {
+    return 0;
+  }
+
+  const int error = bulk_insert_flush();
+
+  bulk_insert_free();
+
+  if (error != 0) {
+    set_my_errno(error);
+  }
+
+  return error;
+}
+
 /** Stores a row in an InnoDB database, to the table specified in this
  handle.
  @return error code */
-
 int ha_innobase::write_row(uchar *record) /*!< in: a row in MySQL format */
 {
   dberr_t error;
@@ -9546,6 +9730,11 @@ int ha_innobase::write_row(uchar *record) /*!< in: a row in MySQL format */
 
   DBUG_TRACE;
 
+  if (m_bulk_heap != nullptr && !m_bulk_flushing &&
+      record == table->record[0]) {
+    return bulk_insert_buffer_row(record);
+  }
+
   /* Increase the write count of handler */
   ha_statistic_increment(&System_status_var::ha_write_count);
 
@@ -10700,6 +10889,17 @@ static bool template_new_is_valid(mysql_row_templ_t *t_new,
 }
 #endif
 
+/** Count a row returned to MySQL in the rows read statistics.
+@param[in]      prebuilt        prebuilt struct of the table handle */
+static inline void innobase_count_row_read(const row_prebuilt_t *prebuilt) {
+  if (prebuilt->table->is_system_table) {
+    srv_stats.n_system_rows_read.add(
+        thd_get_thread_id(prebuilt->trx->mysql_thd), 1);
+  } else {
+    srv_stats.n_rows_read.add(thd_get_thread_id(prebuilt->trx->mysql_thd), 1);
+  }
+}
+
 /*
    BACKGROUND INFO: HOW A SELECT SQL QUERY IS EXECUTED
    ---------------------------------------------------
@@ -10908,13 +11108,7 @@ int ha_innobase::index_read(
   switch (ret) {
     case DB_SUCCESS:
       error = 0;
-      if (m_prebuilt->table->is_system_table) {
-        srv_stats.n_system_rows_read.add(
-            thd_get_thread_id(m_prebuilt->trx->mysql_thd), 1);
-      } else {
-        srv_stats.n_rows_read.add(thd_get_thread_id(m_prebuilt->trx->mysql_thd),
-                                  1);
-      }
+      innobase_count_row_read(m_prebuilt);
       break;
 
     case DB_RECORD_NOT_FOUND:
@@ -11141,6 +11335,13 @@ int ha_innobase::general_fetch(
     return convert_error_code_to_mysql(DB_FORCED_ABORT, 0, m_user_thd);
   }
 
+  /* Rows of a batch that row_search_mvcc() has already prefetched are
+  handed out without entering InnoDB again. */
+  if (!intrinsic && row_search_pop_prefetched(buf, m_prebuilt, direction)) {
+    innobase_count_row_read(m_prebuilt);
+    return 0;
+  }
+
   auto ret = innobase_srv_conc_enter_innodb(m_prebuilt);
 
   if (ret != DB_SUCCESS) {
@@ -11163,13 +11364,7 @@ int ha_innobase::general_fetch(
   switch (ret) {
     case DB_SUCCESS:
       error = 0;
-      if (m_prebuilt->table->is_system_table) {
-        srv_stats.n_system_rows_read.add(
-            thd_get_thread_id(m_prebuilt->trx->mysql_thd), 1);
-      } else {
-        srv_stats.n_rows_read.add(thd_get_thread_id(m_prebuilt->trx->mysql_thd),
-                                  1);
-      }
+      innobase_count_row_read(m_prebuilt);
       break;
     case DB_RECORD_NOT_FOUND:
       error = HA_ERR_END_OF_FILE;
@@ -19074,8 +19269,12 @@ int ha_innobase::extra(enum ha_extra_function operation)
     case HA_EXTRA_INSERT_WITH_UPDATE:
       m_prebuilt->on_duplicate_key_update = 1;
       break;
+    case HA_EXTRA_IGNORE_DUP_KEY:
+      m_ignore_dup_key = true;
+      break;
     case HA_EXTRA_NO_IGNORE_DUP_KEY:
       m_prebuilt->on_duplicate_key_update = 0;
+      m_ignore_dup_key = false;
       break;
     case HA_EXTRA_WRITE_CAN_REPLACE:
       m_prebuilt->replace = 1;
@@ -19108,6 +19307,12 @@ exists for readability only. ha_innobase::reset() doesn't give any
 clue about the method. */
 
 int ha_innobase::end_stmt() {
+  /* Rows still buffered here belong to a statement that failed before
+  end_bulk_insert(), they are rolled back anyway. */
+  bulk_insert_free();
+
+  m_ignore_dup_key = false;
+
   if (m_prebuilt->blob_heap) {
     row_mysql_prebuilt_free_blob_heap(m_prebuilt);
   }
@@ -23009,6 +23214,33 @@ static MYSQL_SYSVAR_ULONG(
     1,                     /* Minimum value */
     5000, 0);              /* Maximum value */
 
+static MYSQL_SYSVAR_ULONG(
+    consistent_read_version_cache_size, srv_cons_read_vers_cache_size,
+    PLUGIN_VAR_RQCMDARG,
+    "Maximum size in bytes of the old record versions that each table handle "
+    "caches for its consistent read view. 0 disables the cache.",
+    nullptr, nullptr, 0, 0, 64 * 1024 * 1024, 0);
+
+static MYSQL_SYSVAR_BOOL(
+    mrr_prefetch, srv_mrr_prefetch, PLUGIN_VAR_OPCMDARG,
+    "Issue asynchronous reads of the clustered index pages of a sorted "
+    "Multi-Range Read batch before its rows are fetched.",
+    nullptr, nullptr, false);
+
+static MYSQL_SYSVAR_BOOL(
+    prefetch_locking_reads, srv_prefetch_locking_reads,
+    PLUGIN_VAR_OPCMDARG | PLUGIN_VAR_READONLY,
+    "Let SELECT ... FOR SHARE/UPDATE at REPEATABLE READ or SERIALIZABLE "
+    "prefetch rows like consistent reads do. The scan may lock, and wait "
+    "for, rows beyond the last one the statement uses.",
+    nullptr, nullptr, false);
+
+static MYSQL_SYSVAR_BOOL(
+    purge_undo_prefetch, srv_purge_undo_prefetch, PLUGIN_VAR_OPCMDARG,
+    "Read the next undo log pages asynchronously while purge handles the "
+    "current ones.",
+    nullptr, nullptr, false);
+
 static MYSQL_SYSVAR_ULONG(purge_threads, srv_n_purge_threads,
                           PLUGIN_VAR_OPCMDARG | PLUGIN_VAR_READONLY,
                           "Purge threads can be from 1 to 32. Default is 4.",
@@ -23163,6 +23395,15 @@ static MYSQL_SYSVAR_BOOL(
     " new statistics)",
     nullptr, nullptr, true);
 
+static MYSQL_SYSVAR_ULONG(
+    stats_auto_recalc_pages_per_second, srv_stats_auto_recalc_pages_per_sec,
+    PLUGIN_VAR_RQCMDARG,
+    "Maximum number of index pages per second that the automatic"
+    " recalculation of persistent statistics may sample; after each table"
+    " the background thread pauses until it is back under this rate"
+    " (0 = no limit)",
+    nullptr, nullptr, 0, 0, ULONG_MAX, 0);
+
 static MYSQL_SYSVAR_ULONGLONG(
     stats_persistent_sample_pages, srv_stats_persistent_sample_pages,
     PLUGIN_VAR_RQCMDARG,
@@ -23185,6 +23426,15 @@ static MYSQL_SYSVAR_ULONG(
     "Number of InnoDB Adaptive Hash Index Partitions. (default = 8). ", nullptr,
     nullptr, 8, 1, 512, 0);
 
+static MYSQL_SYSVAR_ULONG(
+    adaptive_hash_index_min_hit_ratio, btr_search_min_hit_ratio,
+    PLUGIN_VAR_RQCMDARG,
+    "Minimum percentage of adaptive hash index searches in an index that must"
+    " succeed for the index to keep using the adaptive hash index. Indexes"
+    " below it stop using the adaptive hash index for a while."
+    " 0 (the default) disables the check.",
+    nullptr, nullptr, 0, 0, 100, 0);
+
 static MYSQL_SYSVAR_ULONG(
     replication_delay, srv_replication_delay, PLUGIN_VAR_RQCMDARG,
     "Replication thread delay (ms) on the slave server if"
@@ -23212,6 +23462,20 @@ static MYSQL_SYSVAR_ULONG(autoextend_increment,
                           "Data file autoextend increment in megabytes",
                           nullptr, nullptr, 64L, 1L, 1000L, 0);
 
+static MYSQL_SYSVAR_BOOL(
+    sample_index_accesses, srv_sample_index_accesses, PLUGIN_VAR_OPCMDARG,
+    "Count one in 64 buffer pool page accesses per index, see"
+    " INFORMATION_SCHEMA.INNODB_INDEX_ACCESSES (default OFF).",
+    nullptr, nullptr, false);
+
+static MYSQL_SYSVAR_ULONG(
+    session_temp_extend_increment, srv_session_temp_extend_increment,
+    PLUGIN_VAR_RQCMDARG,
+    "Size in megabytes by which session temporary tablespaces (ibt files)"
+    " are extended. 0 (the default) extends them like file-per-table"
+    " tablespaces, by one extent at a time until they reach 32 MiB.",
+    nullptr, nullptr, 0L, 0L, 1000L, 0);
+
 static MYSQL_SYSVAR_BOOL(
     dedicated_server, srv_dedicated_server,
     PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_NOPERSIST | PLUGIN_VAR_READONLY,
@@ -23355,6 +23619,14 @@ static MYSQL_SYSVAR_ULONG(
     0, 0, 256, 0);
 // clang-format on
 
+static MYSQL_SYSVAR_BOOL(
+    doublewrite_atomic_bypass, dblwr::atomic_bypass,
+    PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
+    "Skip the doublewrite buffer for tablespaces whose file is on a device "
+    "that guarantees atomic page writes (RWF_ATOMIC with O_DIRECT). Such "
+    "pages are written with a single untorn write (disabled by default).",
+    nullptr, nullptr, false);
+
 static MYSQL_SYSVAR_ENUM(
     cleaner_lsn_age_factor, srv_cleaner_lsn_age_factor, PLUGIN_VAR_OPCMDARG,
     "The formula for LSN age factor for page cleaner adaptive flushing. "
@@ -23446,11 +23718,25 @@ static MYSQL_SYSVAR_BOOL(
     "Load the buffer pool from a file named @@innodb_buffer_pool_filename",
     nullptr, nullptr, true);
 
+static MYSQL_SYSVAR_ULONG(
+    buffer_pool_load_threads, srv_buf_load_threads, PLUGIN_VAR_RQCMDARG,
+    "Number of threads issuing the page reads of a buffer pool load. Each"
+    " thread loads a contiguous range of the sorted dump and is throttled to"
+    " its share of innodb_io_capacity while there is other activity.",
+    nullptr, nullptr, 1, 1, 64, 0);
+
 static MYSQL_SYSVAR_ULONG(lru_scan_depth, srv_LRU_scan_depth,
                           PLUGIN_VAR_RQCMDARG,
                           "How deep to scan LRU to keep it clean", nullptr,
                           nullptr, 1024, 100, ~0UL, 0);
 
+static MYSQL_SYSVAR_ULONG(
+    lru_ghost_list_size, srv_LRU_ghost_list_size, PLUGIN_VAR_RQCMDARG,
+    "Number of recently evicted page ids remembered per buffer pool instance."
+    " A page read back while still remembered is inserted at the head of the"
+    " LRU list instead of at the midpoint. 0 disables the ghost list.",
+    nullptr, nullptr, 0, 0, ~0UL, 0);
+
 static MYSQL_SYSVAR_ULONG(flush_neighbors, srv_flush_neighbors,
                           PLUGIN_VAR_OPCMDARG,
                           "Set to 0 (don't flush neighbors from buffer pool),"
@@ -23478,6 +23764,14 @@ static MYSQL_SYSVAR_BOOL(
     " and we rely on innodb_lock_wait_timeout in case of deadlock.",
     nullptr, innobase_deadlock_detect_update, true);
 
+static MYSQL_SYSVAR_BOOL(
+    deadlock_detect_incremental, innobase_deadlock_detect_incremental,
+    PLUGIN_VAR_NOCMDARG,
+    "If ON, a new or changed lock wait wakes up the deadlock detector only if "
+    "following the wait-for edges from it leads back to the waiter. The whole "
+    "wait-for graph is still scanned at least once per second (default OFF).",
+    nullptr, nullptr, false);
+
 static MYSQL_SYSVAR_LONG(fill_factor, ddl::fill_factor, PLUGIN_VAR_RQCMDARG,
                          "Percentage of B-tree page filled during bulk insert",
                          nullptr, nullptr, 100, 10, 100, 0);
@@ -23568,6 +23862,14 @@ static MYSQL_SYSVAR_ULONG(force_recovery, srv_force_recovery,
                           "the database becomes corrupt.",
                           nullptr, nullptr, 0, 0, 6, 0);
 
+static MYSQL_SYSVAR_ULONG(
+    recovery_apply_threads, srv_recv_apply_threads,
+    PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
+    "Number of threads applying redo log records to pages during crash "
+    "recovery. The pages of each batch are split into disjoint ranges, one "
+    "per thread.",
+    nullptr, nullptr, 1, 1, 64, 0);
+
 #ifdef UNIV_DEBUG
 static MYSQL_SYSVAR_ULONG(force_recovery_crash, srv_force_recovery_crash,
                           PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
@@ -23625,6 +23927,14 @@ static MYSQL_SYSVAR_ULONG(log_write_ahead_size, srv_log_write_ahead_size,
                           INNODB_LOG_WRITE_AHEAD_SIZE_MAX,
                           OS_FILE_LOG_BLOCK_SIZE);
 
+static MYSQL_SYSVAR_BOOL(
+    log_writer_sync_write, srv_log_writer_sync_write, PLUGIN_VAR_NOCMDARG,
+    "Whether the log writer should make each redo write durable itself, "
+    "issuing the write together with fdatasync (RWF_DSYNC), and notify "
+    "committing transactions directly instead of handing over to the log "
+    "flusher. Used only with innodb_flush_log_at_trx_commit = 1.",
+    nullptr, nullptr, false);
+
 static MYSQL_SYSVAR_BOOL(
     log_writer_threads, srv_log_writer_threads, PLUGIN_VAR_RQCMDARG,
     "Whether the log writer threads should be activated (ON), or write/flush "
@@ -23941,6 +24251,15 @@ static MYSQL_SYSVAR_BOOL(
     PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
     "Use NUMA interleave memory policy to allocate InnoDB buffer pool.",
     nullptr, nullptr, false);
+
+static MYSQL_SYSVAR_BOOL(
+    numa_node_affinity, srv_numa_node_affinity,
+    PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
+    "Bind the memory of each InnoDB buffer pool instance to a single NUMA "
+    "node, assigned round-robin, and run the LRU manager thread of the "
+    "instance on that node. Takes precedence over innodb_numa_interleave for "
+    "the buffer pool pages.",
+    nullptr, nullptr, false);
 #endif /* HAVE_LIBNUMA */
 
 static MYSQL_SYSVAR_BOOL(
@@ -24274,6 +24593,8 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(api_trx_level),
     MYSQL_SYSVAR(api_bk_commit_interval),
     MYSQL_SYSVAR(autoextend_increment),
+    MYSQL_SYSVAR(session_temp_extend_increment),
+    MYSQL_SYSVAR(sample_index_accesses),
     MYSQL_SYSVAR(dedicated_server),
     MYSQL_SYSVAR(buffer_pool_size),
     MYSQL_SYSVAR(buffer_pool_chunk_size),
@@ -24289,7 +24610,9 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(buffer_pool_load_now),
     MYSQL_SYSVAR(buffer_pool_load_abort),
     MYSQL_SYSVAR(buffer_pool_load_at_startup),
+    MYSQL_SYSVAR(buffer_pool_load_threads),
     MYSQL_SYSVAR(lru_scan_depth),
+    MYSQL_SYSVAR(lru_ghost_list_size),
     MYSQL_SYSVAR(flush_neighbors),
     MYSQL_SYSVAR(checksum_algorithm),
     MYSQL_SYSVAR(log_checksums),
@@ -24307,6 +24630,7 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(doublewrite),
     MYSQL_SYSVAR(doublewrite_dir),
     MYSQL_SYSVAR(doublewrite_batch_size),
+    MYSQL_SYSVAR(doublewrite_atomic_bypass),
     MYSQL_SYSVAR(doublewrite_files),
     MYSQL_SYSVAR(doublewrite_pages),
     MYSQL_SYSVAR(stats_include_delete_marked),
@@ -24321,6 +24645,7 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(flush_log_at_trx_commit),
     MYSQL_SYSVAR(flush_method),
     MYSQL_SYSVAR(force_recovery),
+    MYSQL_SYSVAR(recovery_apply_threads),
 #ifdef UNIV_DEBUG
     MYSQL_SYSVAR(force_recovery_crash),
 #endif /* UNIV_DEBUG */
@@ -24336,6 +24661,7 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(force_load_corrupted),
     MYSQL_SYSVAR(lock_wait_timeout),
     MYSQL_SYSVAR(deadlock_detect),
+    MYSQL_SYSVAR(deadlock_detect_incremental),
     MYSQL_SYSVAR(page_size),
     MYSQL_SYSVAR(log_buffer_size),
     MYSQL_SYSVAR(log_file_size),
@@ -24345,6 +24671,7 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(debug_sys_mem_size),
 #endif /* UNIV_DEBUG_DEDICATED */
     MYSQL_SYSVAR(log_write_ahead_size),
+    MYSQL_SYSVAR(log_writer_sync_write),
     MYSQL_SYSVAR(log_group_home_dir),
     MYSQL_SYSVAR(log_writer_threads),
     MYSQL_SYSVAR(log_spin_cpu_abs_lwm),
@@ -24394,8 +24721,10 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(stats_persistent),
     MYSQL_SYSVAR(stats_persistent_sample_pages),
     MYSQL_SYSVAR(stats_auto_recalc),
+    MYSQL_SYSVAR(stats_auto_recalc_pages_per_second),
     MYSQL_SYSVAR(adaptive_hash_index),
     MYSQL_SYSVAR(adaptive_hash_index_parts),
+    MYSQL_SYSVAR(adaptive_hash_index_min_hit_ratio),
     MYSQL_SYSVAR(stats_method),
     MYSQL_SYSVAR(replication_delay),
     MYSQL_SYSVAR(status_file),
@@ -24408,6 +24737,7 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(spin_wait_pause_multiplier),
     MYSQL_SYSVAR(fsync_threshold),
     MYSQL_SYSVAR(table_locks),
+    MYSQL_SYSVAR(sorted_bulk_insert),
     MYSQL_SYSVAR(thread_concurrency),
     MYSQL_SYSVAR(adaptive_max_sleep_delay),
     MYSQL_SYSVAR(thread_sleep_delay),
@@ -24418,6 +24748,7 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(use_native_aio),
 #ifdef HAVE_LIBNUMA
     MYSQL_SYSVAR(numa_interleave),
+    MYSQL_SYSVAR(numa_node_affinity),
 #endif /* HAVE_LIBNUMA */
     MYSQL_SYSVAR(change_buffering),
     MYSQL_SYSVAR(change_buffer_max_size),
@@ -24439,6 +24770,10 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(monitor_reset_all),
     MYSQL_SYSVAR(purge_threads),
     MYSQL_SYSVAR(purge_batch_size),
+    MYSQL_SYSVAR(purge_undo_prefetch),
+    MYSQL_SYSVAR(consistent_read_version_cache_size),
+    MYSQL_SYSVAR(prefetch_locking_reads),
+    MYSQL_SYSVAR(mrr_prefetch),
 #ifdef UNIV_DEBUG
     MYSQL_SYSVAR(background_drop_list_empty),
     MYSQL_SYSVAR(purge_run_now),
@@ -24543,7 +24878,8 @@ mysql_declare_plugin(innobase){
     i_s_innodb_ft_index_cache, i_s_innodb_ft_index_table, i_s_innodb_tables,
     i_s_innodb_tablestats, i_s_innodb_indexes, i_s_innodb_tablespaces,
     i_s_innodb_columns, i_s_innodb_virtual, i_s_innodb_cached_indexes,
-    i_s_innodb_session_temp_tablespaces
+    i_s_innodb_index_accesses,
+    i_s_innodb_adaptive_hash_indexes, i_s_innodb_session_temp_tablespaces
 
     mysql_declare_plugin_end;
 
@@ -24598,6 +24934,126 @@ ha_rows ha_innobase::multi_range_read_info(uint keyno, uint n_ranges, uint keys,
   return (m_ds_mrr.dsmrr_info(keyno, n_ranges, keys, bufsz, flags, cost));
 }
 
+void ha_innobase::prefetch_positions(const uchar *positions, const uchar *end,
+                                     size_t stride) {
+  /* Positions of a table without a primary key are DB_ROW_ID values,
+  which do not convert to a search tuple. */
+  if (!srv_mrr_prefetch || m_prebuilt->clust_index_was_generated ||
+      table->s->primary_key == MAX_KEY || m_prebuilt->table->is_intrinsic() ||
+      dict_table_is_discarded(m_prebuilt->table)) {
+    return;
+  }
+
+  dict_index_t *index = m_prebuilt->table->first_index();
+
+  if (index->is_corrupted()) {
+    return;
+  }
+
+  const KEY *key = table->key_info + table->s->primary_key;
+  const page_size_t page_size(dict_table_page_size(m_prebuilt->table));
+
+  mem_heap_t *heap = mem_heap_create(
+      key->actual_key_parts * sizeof(dfield_t) + sizeof(dtuple_t) + 256,
+      UT_LOCATION_HERE);
+
+  dtuple_t *tuple = dtuple_create(heap, key->actual_key_parts);
+  ulint *offsets = nullptr;
+  page_no_t last_page_no = FIL_NULL;
+
+  /* The level 1 page found for one position is kept latched and searched
+  again for the following ones, as sorted positions usually map to the same
+  node pointer page. Only a bounded number of positions is handled under one
+  mini-transaction, because it holds the index SX-latch. */
+  static constexpr size_t MAX_POSITIONS_PER_MTR = 64;
+
+  mtr_t mtr;
+  bool mtr_active = false;
+  size_t n_positions = 0;
+  const buf_block_t *node_block = nullptr;
+
+  for (auto pos = positions; pos < end; pos += stride) {
+    dict_index_copy_types(tuple, index, key->actual_key_parts);
+
+    row_sel_convert_mysql_key_to_innobase(
+        tuple, m_prebuilt->srch_key_val1, m_prebuilt->srch_key_val_len, index,
+        pos, ref_length);
+
+    const rec_t *node_ptr = nullptr;
+
+    if (mtr_active && ++n_positions < MAX_POSITIONS_PER_MTR) {
+      page_cur_t page_cur;
+
+      page_cur_search(node_block, index, tuple, PAGE_CUR_LE, &page_cur);
+
+      const rec_t *rec = page_cur_get_rec(&page_cur);
+
+      /* The node pointer can only be trusted if it is followed by another
+      one on the same page, or if this is the last page of the level. */
+      if (page_rec_is_user_rec(rec) &&
+          (!page_rec_is_supremum(page_rec_get_next_const(rec)) ||
+           btr_page_get_next(buf_block_get_frame(node_block), &mtr) ==
+               FIL_NULL)) {
+        node_ptr = rec;
+      }
+    }
+
+    if (node_ptr == nullptr) {
+      if (mtr_active) {
+        mtr_commit(&mtr);
+      }
+
+      mtr_start(&mtr);
+      mtr_sx_lock(dict_index_get_lock(index), &mtr, UT_LOCATION_HERE);
+      mtr_active = true;
+      n_positions = 0;
+
+      if (btr_height_get(index, &mtr) == 0) {
+        /* The root is the only leaf page. */
+        break;
+      }
+
+      /* Find the node pointer on level 1 that points to the leaf. */
+      btr_cur_t cursor;
+
+      btr_cur_search_to_nth_level(index, 1, tuple, PAGE_CUR_LE,
+                                  BTR_SEARCH_TREE | BTR_ALREADY_S_LATCHED,
+                                  &cursor, 0, __FILE__, __LINE__, &mtr);
+
+      node_block = btr_cur_get_block(&cursor);
+      node_ptr = btr_cur_get_rec(&cursor);
+    }
+
+    if (!page_rec_is_user_rec(node_ptr)) {
+      continue;
+    }
+
+    offsets = rec_get_offsets(node_ptr, index, offsets, ULINT_UNDEFINED,
+                              UT_LOCATION_HERE, &heap);
+    const page_no_t page_no = btr_node_ptr_get_child_page_no(node_ptr, offsets);
+
+    /* Sorted positions usually hit the same leaf several times. */
+    if (page_no == last_page_no) {
+      continue;
+    }
+
+    last_page_no = page_no;
+
+    const page_id_t page_id(index->space, page_no);
+
+    if (!buf_page_peek(page_id) &&
+        buf_read_page_background(page_id, page_size, false)) {
+      MONITOR_INC(MONITOR_MRR_PAGES_PREFETCHED);
+    }
+  }
+
+  if (mtr_active) {
+    mtr_commit(&mtr);
+  }
+
+  mem_heap_free(heap);
+}
+
 /**
 Index Condition Pushdown interface implementation */
 
@@ -24956,11 +25412,14 @@ bool ha_innobase::is_record_buffer_wanted(ha_rows *const max_rows) const {
     return false;
   }
 
-  /* Limit the number of rows in the buffer to 100 for now. We may want
-  to fine-tune this later, possibly taking record size and page size into
-  account. The optimizer might allocate an even smaller buffer if it
-  thinks a smaller number of rows will be fetched. */
-  *max_rows = 100;
+  /* Let the buffer hold about four pages worth of rows, but no fewer
+  than 100, so that short rows are fetched with fewer cursor restores.
+  The optimizer might allocate an even smaller buffer if it thinks a
+  smaller number of rows will be fetched. */
+  const ha_rows rows_in_pages =
+      4 * srv_page_size / std::max<ulint>(m_prebuilt->mysql_row_len, 1);
+
+  *max_rows = std::clamp<ha_rows>(rows_in_pages, 100, 1000);
   return true;
 }
 
@@ -31,6 +31,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 
 #include <assert.h>
 #include <sys/types.h>
+#include <vector>
 #include "create_field.h"
 #include "field.h"
 #include "handler.h"
@@ -130,6 +131,15 @@ class ha_innobase : public handler {
 
   longlong get_memory_buffer_size() const override;
 
+  /** Start buffering the rows of an INSERT or LOAD DATA statement so that
+  they can be inserted in primary key order, see innodb_sorted_bulk_insert.
+  @param[in]    rows    estimated number of rows, 0 if unknown */
+  void start_bulk_insert(ha_rows rows) override;
+
+  /** Insert the rows still buffered since start_bulk_insert().
+  @return error number or 0 */
+  int end_bulk_insert() override;
+
   int write_row(uchar *buf) override;
 
   int update_row(const uchar *old_data, uchar *new_data) override;
@@ -487,6 +497,14 @@ class ha_innobase : public handler {
   @param[in]      scan_ctx      A scan context created by parallel_scan_init. */
   void parallel_scan_end(void *scan_ctx) override;
 
+  /** Issue asynchronous reads of the clustered index leaf pages that hold
+  the given, sorted, primary key positions and are not in the buffer pool.
+  @param[in]  positions  first position
+  @param[in]  end        end of the positions
+  @param[in]  stride     distance in bytes between consecutive positions */
+  void prefetch_positions(const uchar *positions, const uchar *end,
+                          size_t stride) override;
+
   bool check_if_incompatible_data(HA_CREATE_INFO *info,
                                   uint table_changes) override;
 
@@ -543,6 +561,20 @@ class ha_innobase : public handler {
   /** Write Row Interface optimized for Intrinsic table. */
   int intrinsic_table_write_row(uchar *record);
 
+  /** Append a row to the sorted bulk insert buffer, inserting the buffered
+  rows once the buffer is full.
+  @param[in,out]        record  row in MySQL format, table->record[0]
+  @return error number or 0 */
+  int bulk_insert_buffer_row(uchar *record);
+
+  /** Insert the rows of the sorted bulk insert buffer in primary key order.
+  The buffer memory is not released.
+  @return error number or 0 */
+  int bulk_insert_flush();
+
+  /** Discard the sorted bulk insert buffer. */
+  void bulk_insert_free();
+
   /** Find out if a Record_buffer is wanted by this handler, and what is
   the maximum buffer size the handler wants.
 
@@ -696,6 +728,20 @@ class ha_innobase : public handler {
 
   /** If mysql has locked with external_lock() */
   bool m_mysql_has_locked;
+
+  /** true if the statement asked to ignore duplicate keys,
+  HA_EXTRA_IGNORE_DUP_KEY */
+  bool m_ignore_dup_key{false};
+
+  /** Memory of the rows buffered by a sorted bulk insert, or nullptr if
+  start_bulk_insert() did not enable one */
+  mem_heap_t *m_bulk_heap{nullptr};
+
+  /** Rows buffered by a sorted bulk insert, in MySQL format */
+  std::vector<uchar *> m_bulk_rows;
+
+  /** true while the buffered rows are written to the table */
+  bool m_bulk_flushing{false};
 };
 
 struct trx_t;
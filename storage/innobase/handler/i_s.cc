@@ -47,6 +47,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include "auth_acls.h"
 #include "btr0btr.h"
 #include "btr0pcur.h"
+#include "btr0sea.h"
 #include "btr0types.h"
 #include "buf0buddy.h"
 #include "buf0buf.h"
@@ -3874,6 +3875,20 @@ static ST_FIELD_INFO i_s_innodb_buffer_stats_fields_info[] = {
      STRUCT_FLD(field_flags, MY_I_S_UNSIGNED), STRUCT_FLD(old_name, ""),
      STRUCT_FLD(open_method, 0)},
 
+#define IDX_BUF_STATS_GHOST_LIST_LEN 32
+    {STRUCT_FLD(field_name, "GHOST_LIST_LENGTH"),
+     STRUCT_FLD(field_length, MY_INT64_NUM_DECIMAL_DIGITS),
+     STRUCT_FLD(field_type, MYSQL_TYPE_LONGLONG), STRUCT_FLD(value, 0),
+     STRUCT_FLD(field_flags, MY_I_S_UNSIGNED), STRUCT_FLD(old_name, ""),
+     STRUCT_FLD(open_method, 0)},
+
+#define IDX_BUF_STATS_GHOST_HITS 33
+    {STRUCT_FLD(field_name, "NUMBER_PAGES_GHOST_HITS"),
+     STRUCT_FLD(field_length, MY_INT64_NUM_DECIMAL_DIGITS),
+     STRUCT_FLD(field_type, MYSQL_TYPE_LONGLONG), STRUCT_FLD(value, 0),
+     STRUCT_FLD(field_flags, MY_I_S_UNSIGNED), STRUCT_FLD(old_name, ""),
+     STRUCT_FLD(open_method, 0)},
+
     END_OF_ST_FIELD_INFO};
 
 /** Fill Information Schema table INNODB_BUFFER_POOL_STATS for a particular
@@ -3971,6 +3986,10 @@ static int i_s_innodb_stats_fill(
 
   OK(fields[IDX_BUF_STATS_UNZIP_CUR]->store(info->unzip_cur, true));
 
+  OK(fields[IDX_BUF_STATS_GHOST_LIST_LEN]->store(info->ghost_list_len, true));
+
+  OK(fields[IDX_BUF_STATS_GHOST_HITS]->store(info->n_pages_ghost_hits, true));
+
   return schema_table_store_record(thd, table);
 }
 
@@ -7296,6 +7315,480 @@ struct st_mysql_plugin i_s_innodb_cached_indexes = {
     STRUCT_FLD(flags, 0UL),
 };
 
+/** INFORMATION_SCHEMA.INNODB_INDEX_ACCESSES */
+
+/* Fields of the dynamic table INFORMATION_SCHEMA.INNODB_INDEX_ACCESSES
+Every time any column gets changed, added or removed, please remember
+to change i_s_innodb_plugin_version_postfix accordingly, so that
+the change can be propagated to server */
+static ST_FIELD_INFO innodb_index_accesses_fields_info[] = {
+#define INDEX_ACCESSES_SPACE_ID 0
+    {STRUCT_FLD(field_name, "SPACE_ID"),
+     STRUCT_FLD(field_length, MY_INT32_NUM_DECIMAL_DIGITS),
+     STRUCT_FLD(field_type, MYSQL_TYPE_LONG), STRUCT_FLD(value, 0),
+     STRUCT_FLD(field_flags, MY_I_S_UNSIGNED), STRUCT_FLD(old_name, ""),
+     STRUCT_FLD(open_method, 0)},
+
+#define INDEX_ACCESSES_INDEX_ID 1
+    {STRUCT_FLD(field_name, "INDEX_ID"),
+     STRUCT_FLD(field_length, MY_INT64_NUM_DECIMAL_DIGITS),
+     STRUCT_FLD(field_type, MYSQL_TYPE_LONGLONG), STRUCT_FLD(value, 0),
+     STRUCT_FLD(field_flags, MY_I_S_UNSIGNED), STRUCT_FLD(old_name, ""),
+     STRUCT_FLD(open_method, 0)},
+
+#define INDEX_ACCESSES_N_SAMPLED_ACCESSES 2
+    {STRUCT_FLD(field_name, "N_SAMPLED_ACCESSES"),
+     STRUCT_FLD(field_length, MY_INT64_NUM_DECIMAL_DIGITS),
+     STRUCT_FLD(field_type, MYSQL_TYPE_LONGLONG), STRUCT_FLD(value, 0),
+     STRUCT_FLD(field_flags, MY_I_S_UNSIGNED), STRUCT_FLD(old_name, ""),
+     STRUCT_FLD(open_method, 0)},
+
+#define INDEX_ACCESSES_N_CACHED_PAGES 3
+    {STRUCT_FLD(field_name, "N_CACHED_PAGES"),
+     STRUCT_FLD(field_length, MY_INT64_NUM_DECIMAL_DIGITS),
+     STRUCT_FLD(field_type, MYSQL_TYPE_LONGLONG), STRUCT_FLD(value, 0),
+     STRUCT_FLD(field_flags, MY_I_S_UNSIGNED), STRUCT_FLD(old_name, ""),
+     STRUCT_FLD(open_method, 0)},
+
+    END_OF_ST_FIELD_INFO};
+
+/** Populate INFORMATION_SCHEMA.INNODB_INDEX_ACCESSES.
+@param[in]      thd             user thread
+@param[in]      space_id        space id
+@param[in]      index_id        index id
+@param[in,out]  table_to_fill   fill this table
+@return 0 on success */
+static int i_s_fill_innodb_index_accesses_row(THD *thd, space_id_t space_id,
+                                              ulint index_id,
+                                              TABLE *table_to_fill) {
+  DBUG_TRACE;
+
+  const index_id_t idx_id(space_id, index_id);
+  const uint64_t n_accesses = buf_stat_per_index->get_accesses(idx_id);
+
+  if (n_accesses == 0) {
+    return 0;
+  }
+
+  Field **fields = table_to_fill->field;
+
+  OK(fields[INDEX_ACCESSES_SPACE_ID]->store(space_id, true));
+
+  OK(fields[INDEX_ACCESSES_INDEX_ID]->store(index_id, true));
+
+  OK(fields[INDEX_ACCESSES_N_SAMPLED_ACCESSES]->store(n_accesses, true));
+
+  OK(fields[INDEX_ACCESSES_N_CACHED_PAGES]->store(
+      buf_stat_per_index->get(idx_id), true));
+
+  OK(schema_table_store_record(thd, table_to_fill));
+
+  return 0;
+}
+
+/** Go through each record in INNODB_INDEXES, and fill
+INFORMATION_SCHEMA.INNODB_INDEX_ACCESSES.
+@param[in]      thd     thread
+@param[in,out]  tables  tables to fill
+@return 0 on success */
+static int i_s_innodb_index_accesses_fill_table(THD *thd, Table_ref *tables,
+                                                Item * /* not used */) {
+  MDL_ticket *mdl = nullptr;
+  dict_table_t *dd_indexes;
+  space_id_t space_id;
+  space_index_t index_id{0};
+
+  DBUG_TRACE;
+
+  /* deny access to user without PROCESS_ACL privilege */
+  if (check_global_access(thd, PROCESS_ACL)) {
+    return 0;
+  }
+
+  mem_heap_t *heap = mem_heap_create(100, UT_LOCATION_HERE);
+
+  dict_sys_mutex_enter();
+
+  mtr_t mtr;
+
+  mtr_start(&mtr);
+
+  /* Start the scan of INNODB_INDEXES. */
+  btr_pcur_t pcur;
+  const rec_t *rec = dd_startscan_system(thd, &mdl, &pcur, &mtr,
+                                         dd_indexes_name.c_str(), &dd_indexes);
+
+  /* Process each record in the table. */
+  while (rec != nullptr) {
+    /* Populate a dict_index_t structure with an information
+    from a INNODB_INDEXES row. */
+    bool ret = dd_process_dd_indexes_rec_simple(heap, rec, &index_id, &space_id,
+                                                dd_indexes);
+
+    mtr_commit(&mtr);
+
+    dict_sys_mutex_exit();
+
+    if (ret) {
+      i_s_fill_innodb_index_accesses_row(thd, space_id, index_id,
+                                         tables->table);
+    }
+
+    mem_heap_empty(heap);
+
+    /* Get the next record. */
+    dict_sys_mutex_enter();
+
+    mtr_start(&mtr);
+
+    rec = dd_getnext_system_rec(&pcur, &mtr);
+  }
+
+  mtr_commit(&mtr);
+
+  dd_table_close(dd_indexes, thd, &mdl, true);
+
+  dict_sys_mutex_exit();
+
+  mem_heap_free(heap);
+
+  return 0;
+}
+
+/** Bind the dynamic table INFORMATION_SCHEMA.INNODB_INDEX_ACCESSES.
+@param[in,out]  p       table schema object
+@return 0 on success */
+static int innodb_index_accesses_init(void *p) {
+  ST_SCHEMA_TABLE *schema;
+
+  DBUG_TRACE;
+
+  schema = static_cast<ST_SCHEMA_TABLE *>(p);
+
+  schema->fields_info = innodb_index_accesses_fields_info;
+  schema->fill_table = i_s_innodb_index_accesses_fill_table;
+
+  return 0;
+}
+
+struct st_mysql_plugin i_s_innodb_index_accesses = {
+    /* the plugin type (a MYSQL_XXX_PLUGIN value) */
+    /* int */
+    STRUCT_FLD(type, MYSQL_INFORMATION_SCHEMA_PLUGIN),
+
+    /* pointer to type-specific plugin descriptor */
+    /* void* */
+    STRUCT_FLD(info, &i_s_info),
+
+    /* plugin name */
+    /* const char* */
+    STRUCT_FLD(name, "INNODB_INDEX_ACCESSES"),
+
+    /* plugin author (for SHOW PLUGINS) */
+    /* const char* */
+    STRUCT_FLD(author, plugin_author),
+
+    /* general descriptive text (for SHOW PLUGINS) */
+    /* const char* */
+    STRUCT_FLD(descr, "InnoDB sampled page accesses per index"),
+
+    /* the plugin license (PLUGIN_LICENSE_XXX) */
+    /* int */
+    STRUCT_FLD(license, PLUGIN_LICENSE_GPL),
+
+    /* the function to invoke when plugin is loaded */
+    /* int (*)(void*); */
+    STRUCT_FLD(init, innodb_index_accesses_init),
+
+    /* the function to invoke when plugin is un installed */
+    /* int (*)(void*); */
+    nullptr,
+
+    /* the function to invoke when plugin is unloaded */
+    /* int (*)(void*); */
+    STRUCT_FLD(deinit, i_s_common_deinit),
+
+    /* plugin version (for SHOW PLUGINS) */
+    /* unsigned int */
+    STRUCT_FLD(version, i_s_innodb_plugin_version),
+
+    /* SHOW_VAR* */
+    STRUCT_FLD(status_vars, nullptr),
+
+    /* SYS_VAR** */
+    STRUCT_FLD(system_vars, nullptr),
+
+    /* reserved for dependency checking */
+    /* void* */
+    STRUCT_FLD(__reserved1, nullptr),
+
+    /* Plugin flags */
+    /* unsigned long */
+    STRUCT_FLD(flags, 0UL),
+};
+
+/** INFORMATION_SCHEMA.INNODB_ADAPTIVE_HASH_INDEXES */
+
+/* Fields of the dynamic table INFORMATION_SCHEMA.INNODB_ADAPTIVE_HASH_INDEXES
+Every time any column gets changed, added or removed, please remember
+to change i_s_innodb_plugin_version_postfix accordingly, so that
+the change can be propagated to server */
+static ST_FIELD_INFO innodb_adaptive_hash_indexes_fields_info[] = {
+#define AHI_INDEXES_INDEX_ID 0
+    {STRUCT_FLD(field_name, "INDEX_ID"),
+     STRUCT_FLD(field_length, MY_INT64_NUM_DECIMAL_DIGITS),
+     STRUCT_FLD(field_type, MYSQL_TYPE_LONGLONG), STRUCT_FLD(value, 0),
+     STRUCT_FLD(field_flags, MY_I_S_UNSIGNED), STRUCT_FLD(old_name, ""),
+     STRUCT_FLD(open_method, 0)},
+
+#define AHI_INDEXES_NAME 1
+    {STRUCT_FLD(field_name, "NAME"), STRUCT_FLD(field_length, NAME_LEN + 1),
+     STRUCT_FLD(field_type, MYSQL_TYPE_STRING), STRUCT_FLD(value, 0),
+     STRUCT_FLD(field_flags, 0), STRUCT_FLD(old_name, ""),
+     STRUCT_FLD(open_method, 0)},
+
+#define AHI_INDEXES_TABLE_ID 2
+    {STRUCT_FLD(field_name, "TABLE_ID"),
+     STRUCT_FLD(field_length, MY_INT64_NUM_DECIMAL_DIGITS),
+     STRUCT_FLD(field_type, MYSQL_TYPE_LONGLONG), STRUCT_FLD(value, 0),
+     STRUCT_FLD(field_flags, MY_I_S_UNSIGNED), STRUCT_FLD(old_name, ""),
+     STRUCT_FLD(open_method, 0)},
+
+#define AHI_INDEXES_SPACE 3
+    {STRUCT_FLD(field_name, "SPACE"),
+     STRUCT_FLD(field_length, MY_INT32_NUM_DECIMAL_DIGITS),
+     STRUCT_FLD(field_type, MYSQL_TYPE_LONG), STRUCT_FLD(value, 0),
+     STRUCT_FLD(field_flags, MY_I_S_UNSIGNED), STRUCT_FLD(old_name, ""),
+     STRUCT_FLD(open_method, 0)},
+
+#define AHI_INDEXES_PART 4
+    {STRUCT_FLD(field_name, "PART"),
+     STRUCT_FLD(field_length, MY_INT32_NUM_DECIMAL_DIGITS),
+     STRUCT_FLD(field_type, MYSQL_TYPE_LONG), STRUCT_FLD(value, 0),
+     STRUCT_FLD(field_flags, MY_I_S_UNSIGNED), STRUCT_FLD(old_name, ""),
+     STRUCT_FLD(open_method, 0)},
+
+#define AHI_INDEXES_N_HASHED_PAGES 5
+    {STRUCT_FLD(field_name, "N_HASHED_PAGES"),
+     STRUCT_FLD(field_length, MY_INT64_NUM_DECIMAL_DIGITS),
+     STRUCT_FLD(field_type, MYSQL_TYPE_LONGLONG), STRUCT_FLD(value, 0),
+     STRUCT_FLD(field_flags, MY_I_S_UNSIGNED), STRUCT_FLD(old_name, ""),
+     STRUCT_FLD(open_method, 0)},
+
+#define AHI_INDEXES_N_HITS 6
+    {STRUCT_FLD(field_name, "N_HASH_SEARCHES_SUCCEEDED"),
+     STRUCT_FLD(field_length, MY_INT64_NUM_DECIMAL_DIGITS),
+     STRUCT_FLD(field_type, MYSQL_TYPE_LONGLONG), STRUCT_FLD(value, 0),
+     STRUCT_FLD(field_flags, MY_I_S_UNSIGNED), STRUCT_FLD(old_name, ""),
+     STRUCT_FLD(open_method, 0)},
+
+#define AHI_INDEXES_N_MISSES 7
+    {STRUCT_FLD(field_name, "N_HASH_SEARCHES_FAILED"),
+     STRUCT_FLD(field_length, MY_INT64_NUM_DECIMAL_DIGITS),
+     STRUCT_FLD(field_type, MYSQL_TYPE_LONGLONG), STRUCT_FLD(value, 0),
+     STRUCT_FLD(field_flags, MY_I_S_UNSIGNED), STRUCT_FLD(old_name, ""),
+     STRUCT_FLD(open_method, 0)},
+
+#define AHI_INDEXES_DISABLED 8
+    {STRUCT_FLD(field_name, "DISABLED"),
+     STRUCT_FLD(field_length, MY_INT32_NUM_DECIMAL_DIGITS),
+     STRUCT_FLD(field_type, MYSQL_TYPE_LONG), STRUCT_FLD(value, 0),
+     STRUCT_FLD(field_flags, MY_I_S_UNSIGNED), STRUCT_FLD(old_name, ""),
+     STRUCT_FLD(open_method, 0)},
+
+    END_OF_ST_FIELD_INFO};
+
+/** A row of INFORMATION_SCHEMA.INNODB_ADAPTIVE_HASH_INDEXES, copied from
+dict_index_t::search_info while holding dict_sys->mutex. */
+struct ahi_index_info_t {
+  space_index_t m_index_id;
+  char m_index_name[NAME_LEN + 1];
+  table_id_t m_table_id;
+  space_id_t m_space_id;
+  size_t m_part;
+  uint64_t m_n_hashed_pages;
+  uint64_t m_n_hits;
+  uint64_t m_n_misses;
+  bool m_disabled;
+};
+
+typedef std::vector<ahi_index_info_t, ut::allocator<ahi_index_info_t>>
+    ahi_index_info_cache_t;
+
+/** Collect the AHI statistics of the indexes of a cached table.
+@param[in]      table   table
+@param[in,out]  cache   append the rows to this cache */
+static void innodb_ahi_indexes_populate_cache(const dict_table_t *table,
+                                              ahi_index_info_cache_t *cache) {
+  for (auto index : table->indexes) {
+    const btr_search_t *info = index->search_info;
+
+    if (index->disable_ahi || dict_index_is_spatial(index) ||
+        info == nullptr) {
+      continue;
+    }
+
+    ahi_index_info_t row;
+
+    row.m_n_hashed_pages = info->ref_count.load();
+    row.m_n_hits = info->n_ahi_hits.load();
+    row.m_n_misses = info->n_ahi_misses.load();
+    row.m_disabled = info->hash_disabled.load();
+
+    if (row.m_n_hashed_pages == 0 && row.m_n_hits == 0 &&
+        row.m_n_misses == 0) {
+      continue;
+    }
+
+    row.m_index_id = index->id;
+    snprintf(row.m_index_name, sizeof(row.m_index_name), "%s", index->name());
+    row.m_table_id = table->id;
+    row.m_space_id = index->space;
+    row.m_part = btr_get_search_part_no(index);
+
+    cache->push_back(row);
+  }
+}
+
+/** Store a row of INFORMATION_SCHEMA.INNODB_ADAPTIVE_HASH_INDEXES.
+@param[in]      thd     user thread
+@param[in]      row     collected index information
+@param[in,out]  table   fill this table
+@return 0 on success */
+static int i_s_innodb_ahi_indexes_fill(THD *thd, const ahi_index_info_t &row,
+                                       TABLE *table) {
+  Field **fields = table->field;
+
+  OK(fields[AHI_INDEXES_INDEX_ID]->store(row.m_index_id, true));
+
+  OK(field_store_string(fields[AHI_INDEXES_NAME], row.m_index_name));
+
+  OK(fields[AHI_INDEXES_TABLE_ID]->store(row.m_table_id, true));
+
+  OK(fields[AHI_INDEXES_SPACE]->store(row.m_space_id, true));
+
+  OK(fields[AHI_INDEXES_PART]->store(row.m_part, true));
+
+  OK(fields[AHI_INDEXES_N_HASHED_PAGES]->store(row.m_n_hashed_pages, true));
+
+  OK(fields[AHI_INDEXES_N_HITS]->store(row.m_n_hits, true));
+
+  OK(fields[AHI_INDEXES_N_MISSES]->store(row.m_n_misses, true));
+
+  OK(fields[AHI_INDEXES_DISABLED]->store(row.m_disabled, true));
+
+  return schema_table_store_record(thd, table);
+}
+
+/** Fill INFORMATION_SCHEMA.INNODB_ADAPTIVE_HASH_INDEXES with the indexes of
+the tables in the dictionary cache which have used the adaptive hash index.
+@param[in]      thd     thread
+@param[in,out]  tables  tables to fill
+@return 0 on success */
+static int i_s_innodb_ahi_indexes_fill_table(THD *thd, Table_ref *tables,
+                                             Item * /* not used */) {
+  int status = 0;
+
+  DBUG_TRACE;
+
+  /* deny access to user without PROCESS_ACL privilege */
+  if (check_global_access(thd, PROCESS_ACL)) {
+    return 0;
+  }
+
+  ahi_index_info_cache_t cache;
+
+  dict_sys_mutex_enter();
+  for (auto table : dict_sys->table_LRU) {
+    innodb_ahi_indexes_populate_cache(table, &cache);
+  }
+  for (auto table : dict_sys->table_non_LRU) {
+    innodb_ahi_indexes_populate_cache(table, &cache);
+  }
+  dict_sys_mutex_exit();
+
+  for (const auto &row : cache) {
+    status = i_s_innodb_ahi_indexes_fill(thd, row, tables->table);
+    if (status) {
+      break;
+    }
+  }
+
+  return status;
+}
+
+/** Bind the dynamic table INFORMATION_SCHEMA.INNODB_ADAPTIVE_HASH_INDEXES.
+@param[in,out]  p       table schema object
+@return 0 on success */
+static int innodb_adaptive_hash_indexes_init(void *p) {
+  ST_SCHEMA_TABLE *schema;
+
+  DBUG_TRACE;
+
+  schema = static_cast<ST_SCHEMA_TABLE *>(p);
+
+  schema->fields_info = innodb_adaptive_hash_indexes_fields_info;
+  schema->fill_table = i_s_innodb_ahi_indexes_fill_table;
+
+  return 0;
+}
+
+struct st_mysql_plugin i_s_innodb_adaptive_hash_indexes = {
+    /* the plugin type (a MYSQL_XXX_PLUGIN value) */
+    /* int */
+    STRUCT_FLD(type, MYSQL_INFORMATION_SCHEMA_PLUGIN),
+
+    /* pointer to type-specific plugin descriptor */
+    /* void* */
+    STRUCT_FLD(info, &i_s_info),
+
+    /* plugin name */
+    /* const char* */
+    STRUCT_FLD(name, "INNODB_ADAPTIVE_HASH_INDEXES"),
+
+    /* plugin author (for SHOW PLUGINS) */
+    /* const char* */
+    STRUCT_FLD(author, plugin_author),
+
+    /* general descriptive text (for SHOW PLUGINS) */
+    /* const char* */
+    STRUCT_FLD(descr, "InnoDB adaptive hash index usage per index"),
+
+    /* the plugin license (PLUGIN_LICENSE_XXX) */
+    /* int */
+    STRUCT_FLD(license, PLUGIN_LICENSE_GPL),
+
+    /* the function to invoke when plugin is loaded */
+    /* int (*)(void*); */
+    STRUCT_FLD(init, innodb_adaptive_hash_indexes_init),
+
+    /* the function to invoke when plugin is un installed */
+    /* int (*)(void*); */
+    nullptr,
+
+    /* the function to invoke when plugin is unloaded */
+    /* int (*)(void*); */
+    STRUCT_FLD(deinit, i_s_common_deinit),
+
+    /* plugin version (for SHOW PLUGINS) */
+    /* unsigned int */
+    STRUCT_FLD(version, i_s_innodb_plugin_version),
+
+    /* SHOW_VAR* */
+    STRUCT_FLD(status_vars, nullptr),
+
+    /* SYS_VAR** */
+    STRUCT_FLD(system_vars, nullptr),
+
+    /* reserved for dependency checking */
+    /* void* */
+    STRUCT_FLD(__reserved1, nullptr),
+
+    /* Plugin flags */
+    /* unsigned long */
+    STRUCT_FLD(flags, 0UL),
+};
+
 /**  INNODB_SESSION_TEMPORARY TABLESPACES   ***********************/
 /* Fields of the dynamic table
 INFORMATION_SCHEMA.INNODB_SESSION_TEMPORARY_TABLESPACES */
@@ -794,9 +794,16 @@ size_t Innodb_data_lock_iterator::scan_trx(
         index_name = lock_rec_get_index_name(lock);
         index_name_length = strlen(index_name);
 
-        heap_no = lock_rec_find_set_bit(lock);
+        /* When looking for a given record, start right at its heap_no
+        instead of walking every bit set before it. */
+        heap_no = (with_filter && filter_heap_id > 0)
+                      ? lock_rec_find_next_set_bit(lock, filter_heap_id - 1)
+                      : lock_rec_find_set_bit(lock);
 
         while (heap_no != ULINT_UNDEFINED) {
+          if (with_filter && heap_no > filter_heap_id) {
+            break;
+          }
           if (!with_filter || (heap_no == filter_heap_id)) {
             print_record_lock_id(lock, heap_no, engine_lock_id,
                                  sizeof(engine_lock_id));
@@ -828,6 +835,11 @@ size_t Innodb_data_lock_iterator::scan_trx(
       default:
         ut_error;
     }
+
+    /* The immutable id identifies a single lock of this trx. */
+    if (with_filter) {
+      break;
+    }
   }
 
   return found;
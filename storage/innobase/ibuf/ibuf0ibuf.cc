@@ -293,6 +293,12 @@ static ib_mutex_t ibuf_bitmap_mutex;
 /** The area in pages from which contract looks for page numbers for merge */
 const ulint IBUF_MERGE_AREA = 8;
 
+/** Position of the key-ordered background merge sweep: the next batch
+starts at the first change buffer record of (space, page) at or after
+this position. Only accessed by the master thread. */
+static space_id_t ibuf_sweep_space = 0;
+static page_no_t ibuf_sweep_page = 0;
+
 /** Inside the merge area, pages which have at most 1 per this number less
 buffered entries compared to maximum volume that can buffered for a single
 page are merged along with the page whose buffer became full */
@@ -2234,9 +2240,12 @@ inline ulint ibuf_get_merge_page_nos(bool contract, const rec_t *rec,
  empty */
 static ulint ibuf_merge_pages(
     ulint *n_pages, /*!< out: number of pages to which merged */
-    bool sync)      /*!< in: true if the caller wants to wait for
+    bool sync,      /*!< in: true if the caller wants to wait for
                     the issued read with the highest tablespace
                     address to complete */
+    bool sweep)     /*!< in: true to continue the key-ordered sweep
+                    of the background merge instead of picking a
+                    random leaf */
 {
   mtr_t mtr;
   btr_pcur_t pcur;
@@ -2251,14 +2260,28 @@ static ulint ibuf_merge_pages(
 
   ibuf_mtr_start(&mtr);
 
-  /* Open a cursor to a randomly chosen leaf of the tree, at a random
-  position within the leaf */
-  bool available;
+  if (sweep) {
+    /* Open a cursor at the sweep position, so that successive
+    background batches visit the buffered changes in key order and
+    the reads of each batch are issued in ascending page order */
+    mem_heap_t *heap = mem_heap_create(512, UT_LOCATION_HERE);
+    dtuple_t *tuple =
+        ibuf_search_tuple_build(ibuf_sweep_space, ibuf_sweep_page, heap);
+
+    pcur.open(ibuf->index, 0, tuple, PAGE_CUR_GE, BTR_SEARCH_LEAF, &mtr,
+              UT_LOCATION_HERE);
 
-  available = pcur.set_random_position(ibuf->index, BTR_SEARCH_LEAF, &mtr,
-                                       UT_LOCATION_HERE);
-  /* No one should make this index unavailable when server is running */
-  ut_a(available);
+    mem_heap_free(heap);
+  } else {
+    /* Open a cursor to a randomly chosen leaf of the tree, at a random
+    position within the leaf */
+    bool available;
+
+    available = pcur.set_random_position(ibuf->index, BTR_SEARCH_LEAF, &mtr,
+                                         UT_LOCATION_HERE);
+    /* No one should make this index unavailable when server is running */
+    ut_a(available);
+  }
 
   ut_ad(page_validate(pcur.get_page(), ibuf->index));
 
@@ -2276,8 +2299,32 @@ static ulint ibuf_merge_pages(
     return (0);
   }
 
+  if (sweep) {
+    if (ibuf_get_user_rec(&pcur, &mtr) == nullptr) {
+      /* The sweep reached the end of the tree: start over from the
+      beginning with the next batch */
+      ibuf_mtr_commit(&mtr);
+      pcur.close();
+
+      const bool restarted = ibuf_sweep_space != 0 || ibuf_sweep_page != 0;
+
+      ibuf_sweep_space = 0;
+      ibuf_sweep_page = 0;
+
+      return (restarted ? ibuf_merge_pages(n_pages, sync, true) : 0);
+    }
+  }
+
   sum_sizes = ibuf_get_merge_page_nos(true, pcur.get_rec(), &mtr, space_ids,
                                       page_nos, n_pages);
+
+  if (sweep && *n_pages > 0) {
+    /* The page numbers are in ascending order within one space */
+    ibuf_sweep_space = space_ids[*n_pages - 1];
+    ibuf_sweep_page = page_nos[*n_pages - 1] + 1;
+
+    MONITOR_INC_VALUE(MONITOR_IBUF_SWEEP_MERGE_PAGES, *n_pages);
+  }
 #if 0 /* defined UNIV_IBUF_DEBUG */
   fprintf(stderr, "Ibuf contract sync %lu pages %lu volume %lu\n",
     sync, *n_pages, sum_sizes);
@@ -2355,10 +2402,13 @@ ulint ibuf_merge_space(space_id_t space) /*!< in: tablespace id to merge */
 @param[out]     n_pages         number of pages merged
 @param[in]      sync            whether the caller waits for
 the issued reads to complete
+@param[in]      sweep           whether to continue the key-ordered
+sweep instead of merging around a random position
 @return a lower limit for the combined size in bytes of entries which
 will be merged from ibuf trees to the pages read, 0 if ibuf is
 empty */
-[[nodiscard]] static ulint ibuf_merge(ulint *n_pages, bool sync) {
+[[nodiscard]] static ulint ibuf_merge(ulint *n_pages, bool sync,
+                                      bool sweep) {
   *n_pages = 0;
 
   /* We perform a dirty read of ibuf->empty, without latching
@@ -2373,7 +2423,7 @@ empty */
     return (0);
 #endif /* UNIV_DEBUG || UNIV_IBUF_DEBUG */
   } else {
-    return (ibuf_merge_pages(n_pages, sync));
+    return (ibuf_merge_pages(n_pages, sync, sweep));
   }
 }
 
@@ -2385,7 +2435,7 @@ will be merged from ibuf trees to the pages read, 0 if ibuf is empty */
 static ulint ibuf_contract(bool sync) {
   ulint n_pages;
 
-  return (ibuf_merge_pages(&n_pages, sync));
+  return (ibuf_merge_pages(&n_pages, sync, false));
 }
 
 /** Contract the change buffer by reading pages to the buffer pool.
@@ -2432,7 +2482,7 @@ ulint ibuf_merge_in_background(bool full) {
   while (sum_pages < n_pages) {
     ulint n_bytes;
 
-    n_bytes = ibuf_merge(&n_pag2, false);
+    n_bytes = ibuf_merge(&n_pag2, false, true);
 
     if (n_bytes == 0) {
       return (sum_bytes);
@@ -67,6 +67,27 @@ struct btr_search_t {
 
   std::atomic<btr_search_prefix_info_t> prefix_info;
   static_assert(decltype(prefix_info)::is_always_lock_free);
+
+  /** @{ Hit ratio tracking, see btr_search_min_hit_ratio. These are not
+  protected by any latch and the values are approximate. */
+
+  /** number of hash searches that found the searched record */
+  std::atomic<uint64_t> n_ahi_hits;
+  /** number of hash searches that did not find the searched record */
+  std::atomic<uint64_t> n_ahi_misses;
+  /** number of hash searches since the hit ratio was last evaluated */
+  std::atomic<uint32_t> window_searches;
+  /** number of successful hash searches since the hit ratio was last
+  evaluated */
+  std::atomic<uint32_t> window_hits;
+  /** true if the hit ratio of this index fell below btr_search_min_hit_ratio:
+  no searches use the AHI, no pages get hashed, and hashed pages are dropped
+  from the AHI when they are modified */
+  std::atomic<bool> hash_disabled;
+  /** number of searches since hash_disabled was set, the index is given
+  another chance when this reaches BTR_SEARCH_HIT_RATIO_RETRY */
+  std::atomic<uint64_t> n_disabled_searches;
+  /** @} */
 #ifdef UNIV_SEARCH_PERF_STAT
   /** number of successful hash searches so far. */
   std::atomic<ulint> n_hash_succ;
@@ -312,6 +333,11 @@ static inline void btr_search_s_unlock_all();
 @return hash value of the index */
 static inline size_t btr_search_hash_index_id(const dict_index_t *index);
 
+/** Gets the number of the adaptive search part used by a specified index.
+@param[in]      index   Index structure
+@return part number, less than btr_ahi_parts */
+static inline size_t btr_get_search_part_no(const dict_index_t *index);
+
 /** Gets a pointer to a adaptive search part structure for a specified index.
 @param[in]      index   Index structure
 @return hash value of the index */
@@ -344,6 +370,14 @@ constexpr uint32_t BTR_SEARCH_ON_PATTERN_LIMIT = 3;
 the hash index */
 constexpr uint32_t BTR_SEARCH_ON_HASH_LIMIT = 3;
 
+/** Number of hash searches in an index after which its hit ratio is compared
+to btr_search_min_hit_ratio */
+constexpr uint32_t BTR_SEARCH_HIT_RATIO_WINDOW = 1024;
+
+/** Number of searches in an index for which the AHI stays disabled after its
+hit ratio fell below btr_search_min_hit_ratio */
+constexpr uint64_t BTR_SEARCH_HIT_RATIO_RETRY = 1024 * 1024;
+
 #include "btr0sea.ic"
 
 #endif
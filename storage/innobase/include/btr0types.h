@@ -59,6 +59,10 @@ extern ulong btr_ahi_parts;
 partition. */
 extern ut::fast_modulo_t btr_ahi_parts_fast_modulo;
 
+/** Minimum percentage of successful adaptive hash index searches in an index,
+below which the AHI is disabled for the index. 0 disables the check. */
+extern ulong btr_search_min_hit_ratio;
+
 /** The size of a reference to data stored on a different page.
 The reference is stored at the end of the prefix of the field
 in the index record. */
@@ -173,6 +173,10 @@ struct buf_pool_info_t {
                                      LIST */
   ulint n_pages_made_young;          /*!< number of pages made young */
   ulint n_pages_not_made_young;      /*!< number of pages not made young */
+  ulint n_pages_ghost_hits;          /*!< number of pages made young on
+                                     read because they were on the
+                                     ghost list */
+  ulint ghost_list_len;              /*!< Length of buf_pool->LRU_ghost */
   ulint n_pages_read;                /*!< buf_pool->n_pages_read */
   ulint n_pages_created;             /*!< buf_pool->n_pages_created */
   ulint n_pages_written;             /*!< buf_pool->n_pages_written */
@@ -2108,6 +2112,10 @@ struct buf_pool_stat_t {
   enough ago, in buf_page_peek_if_too_old(). Not protected. */
   uint64_t n_pages_not_made_young;
 
+  /** Number of pages read in and made young at once because they were found
+  on the ghost list. Protected by LRU_list_mutex. */
+  uint64_t n_pages_ghost_hits;
+
   /** LRU size in bytes. Protected by LRU_list_mutex. */
   uint64_t LRU_bytes;
 
@@ -2135,6 +2143,8 @@ struct buf_pool_stat_t {
 
     dst.n_pages_not_made_young = src.n_pages_not_made_young;
 
+    dst.n_pages_ghost_hits = src.n_pages_ghost_hits;
+
     dst.LRU_bytes = src.LRU_bytes;
 
     dst.flush_list_bytes = src.flush_list_bytes;
@@ -2153,6 +2163,7 @@ struct buf_pool_stat_t {
     n_ra_pages_evicted = 0;
     n_pages_made_young = 0;
     n_pages_not_made_young = 0;
+    n_pages_ghost_hits = 0;
     LRU_bytes = 0;
     flush_list_bytes = 0;
     buf_lru_flush_page_count = 0;
@@ -2219,6 +2230,10 @@ struct buf_pool_t {
   /** Array index of this buffer pool instance */
   ulint instance_no;
 
+  /** NUMA node the chunks of this instance are bound to, or
+  ULINT_UNDEFINED if innodb_numa_node_affinity is not in effect */
+  ulint numa_node;
+
   /** Current pool size in bytes */
   ulint curr_pool_size;
 
@@ -2319,6 +2334,11 @@ struct buf_pool_t {
   flushing to be stopped. */
   os_event_t run_lru;
 
+  /** Pages per second the LRU manager thread of this instance flushed or
+  evicted during its last measurement period, see
+  MONITOR_LRU_MANAGER_FREE_PAGE_RATE */
+  std::atomic<ulint> lru_free_page_rate;
+
   /** A red-black tree is used exclusively during recovery to speed up
   insertions in the flush_list. This tree contains blocks in order of
   oldest_modification LSN and is kept in sync with the flush_list.  Each
@@ -2392,6 +2412,10 @@ struct buf_pool_t {
   LRU_list_mutex. */
   UT_LIST_BASE_NODE_T(buf_block_t, unzip_LRU) unzip_LRU;
 
+  /** Ids of the pages recently evicted from LRU, used when
+  innodb_lru_ghost_list_size > 0. Protected by LRU_list_mutex. */
+  buf_LRU_ghost_t *LRU_ghost;
+
   /** @} */
   /** @name Buddy allocator fields
   The buddy allocator is used for allocating compressed page
@@ -414,6 +414,10 @@ extern ulong n_files;
 /** Maximum number of pages to write in one batch. */
 extern ulong batch_size;
 
+/** true if the doublewrite buffer is skipped for tablespaces whose file is
+on a device that guarantees atomic page writes. */
+extern bool atomic_bypass;
+
 /** Toggle the doublewrite buffer. */
 void set();
 
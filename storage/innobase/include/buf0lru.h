@@ -39,6 +39,9 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include "univ.i"
 #ifndef UNIV_HOTBACKUP
 #include "ut0byte.h"
+#include "ut0new.h"
+
+#include <deque>
 
 // Forward declaration
 struct trx_t;
@@ -258,6 +261,77 @@ inline void buf_LRU_stat_inc_io() { buf_LRU_stat_cur.io++; }
 /** Increments the page_zip_decompress() counter in buf_LRU_stat_cur. */
 inline void buf_LRU_stat_inc_unzip() { buf_LRU_stat_cur.unzip++; }
 
+/** @brief Ghost list of a buffer pool instance.
+
+Remembers the ids, but not the frames, of the pages most recently evicted
+from the LRU list. A page which is read back while it is still remembered
+was evicted too early, typically by a scan sharing the buffer pool, and is
+inserted at the head of the LRU list instead of at the midpoint.
+
+Only the page_id_t::hash() of the evicted pages is kept, a collision merely
+makes one page young too early. Protected by buf_pool_t::LRU_list_mutex. */
+class buf_LRU_ghost_t {
+ public:
+  /** Remember an evicted page, forgetting the oldest ones if needed.
+  @param[in]    page_id         id of the evicted page
+  @param[in]    capacity        maximum number of pages to remember */
+  void insert(const page_id_t &page_id, size_t capacity) {
+    const auto fold = page_id.hash();
+
+    m_ids[fold] = ++m_seq;
+    m_fifo.emplace_back(fold, m_seq);
+
+    trim(capacity);
+  }
+
+  /** Forget a page if it is remembered.
+  @param[in]    page_id         id of the page being read in
+  @return true if the page was on the ghost list */
+  bool remove(const page_id_t &page_id) {
+    return m_ids.erase(page_id.hash()) > 0;
+  }
+
+  /** Forget the oldest pages until at most capacity are remembered.
+  @param[in]    capacity        maximum number of pages to remember */
+  void trim(size_t capacity) {
+    while (!m_fifo.empty()) {
+      const auto &oldest = m_fifo.front();
+      const auto it = m_ids.find(oldest.first);
+      /* Entries of pages which were removed or inserted again later are
+      stale, they are dropped as soon as they reach the front. The FIFO is
+      also bounded on its own so that stale entries cannot pile up behind
+      a long lived one. */
+      const bool live = it != m_ids.end() && it->second == oldest.second;
+
+      if (live && m_ids.size() <= capacity &&
+          m_fifo.size() <= 2 * capacity) {
+        break;
+      }
+
+      if (live) {
+        m_ids.erase(it);
+      }
+
+      m_fifo.pop_front();
+    }
+  }
+
+  /** @return number of pages remembered */
+  size_t size() const { return m_ids.size(); }
+
+ private:
+  /** Page_id_t::hash() of remembered pages to their insertion sequence */
+  ut::unordered_map<uint64_t, uint64_t> m_ids;
+
+  /** (page_id_t::hash(), insertion sequence) in insertion order */
+  std::deque<std::pair<uint64_t, uint64_t>,
+             ut::allocator<std::pair<uint64_t, uint64_t>>>
+      m_fifo;
+
+  /** Last insertion sequence number handed out */
+  uint64_t m_seq{0};
+};
+
 #endif /* !UNIV_HOTBACKUP */
 
 #endif
@@ -44,17 +44,23 @@ this program; if not, write to the Free Software Foundation, Inc.,
 /** Per index buffer pool statistics - contains how many pages for each index
 are cached in the buffer pool(s). This is a key,value store where the key is
 the index id and the value is the number of pages in the buffer pool that
-belong to this index. */
+belong to this index. A second store counts the sampled page accesses of each
+index, see innodb_sample_index_accesses. */
 class buf_stat_per_index_t {
  public:
   /** Constructor. */
   buf_stat_per_index_t() {
     m_store = ut::new_withkey<ut_lock_free_hash_t>(
         ut::make_psi_memory_key(mem_key_buf_stat_per_index_t), 1024, true);
+    m_accesses = ut::new_withkey<ut_lock_free_hash_t>(
+        ut::make_psi_memory_key(mem_key_buf_stat_per_index_t), 1024, true);
   }
 
   /** Destructor. */
-  ~buf_stat_per_index_t() { ut::delete_(m_store); }
+  ~buf_stat_per_index_t() {
+    ut::delete_(m_accesses);
+    ut::delete_(m_store);
+  }
 
   /** Increment the number of pages for a given index with 1.
   @param[in]    id      id of the index whose count to increment */
@@ -95,6 +101,33 @@ class buf_stat_per_index_t {
     return (static_cast<uint64_t>(ret >= 0 ? ret : 0));
   }
 
+  /** Count a sampled access to a page of a given index.
+  @param[in]    id      id of the index whose page was accessed */
+  void inc_accesses(const index_id_t &id) {
+    if (should_skip(id)) {
+      return;
+    }
+
+    m_accesses->inc(id.conv_to_int());
+  }
+
+  /** Get the number of sampled page accesses of a given index.
+  @param[in]    id      id of the index
+  @return number of sampled accesses */
+  uint64_t get_accesses(const index_id_t &id) {
+    if (should_skip(id)) {
+      return (0);
+    }
+
+    const int64_t ret = m_accesses->get(id.conv_to_int());
+
+    if (ret == ut_lock_free_hash_t::NOT_FOUND) {
+      return (0);
+    }
+
+    return (static_cast<uint64_t>(ret >= 0 ? ret : 0));
+  }
+
  private:
   /** Assess if we should skip a page from accounting.
   @param[in]    id      index_id of the page
@@ -108,6 +141,9 @@ class buf_stat_per_index_t {
 
   /** (key, value) storage. */
   ut_lock_free_hash_t *m_store;
+
+  /** (index id, sampled page accesses) storage. */
+  ut_lock_free_hash_t *m_accesses;
 };
 
 /** Container for how many pages from each index are contained in the buffer
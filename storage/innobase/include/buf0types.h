@@ -53,6 +53,8 @@ struct buf_chunk_t;
 struct buf_pool_t;
 /** Buffer pool statistics struct */
 struct buf_pool_stat_t;
+/** Buffer pool ghost list */
+class buf_LRU_ghost_t;
 /** Buffer pool buddy statistics struct */
 struct buf_buddy_stat_t;
 /** Doublewrite memory struct */
@@ -112,6 +112,10 @@ struct File_reader : private ut::Non_copyable {
 
   [[nodiscard]] size_t get_read_len_next() const noexcept;
 
+  /** Ask the OS to start reading the block that follows the one just read,
+  so that it arrives while the rows of the current block are merged. */
+  void prefetch_next() const noexcept;
+
  public:
   using Offsets = std::vector<ulint, ut::allocator<ulint>>;
 
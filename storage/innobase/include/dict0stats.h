@@ -39,6 +39,8 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include "mem0mem.h"
 #include "trx0types.h"
 
+#include <atomic>
+
 enum dict_stats_upd_option_t {
   DICT_STATS_RECALC_PERSISTENT, /* (re) calculate the
                            statistics using a precise and slow
@@ -61,6 +63,10 @@ enum dict_stats_upd_option_t {
                           otherwise do nothing */
 };
 
+/** Number of index pages fetched while sampling persistent statistics,
+used to pace the background recalculation. */
+extern std::atomic<uint64_t> dict_stats_n_pages_sampled;
+
 /** Set the persistent statistics flag for a given table. This is set only in
 the in-memory table object and is not saved on disk. It will be read from the
 .frm file upon first open from MySQL after a server restart.
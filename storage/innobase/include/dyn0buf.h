@@ -38,6 +38,32 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include "univ.i"
 #include "ut0lst.h"
 
+namespace dyn_buf_arena {
+
+/** Size of the first block of a heap taken from the arena. Small log and
+memo buffers live in the first block of dyn_buf_t, larger ones (BLOB and
+bulk insert mini-transactions) in the heap, which should rarely need more
+than its first block. */
+constexpr ulint HEAP_SIZE = 16 * 1024;
+
+/** Maximum number of heaps cached per thread. A mini-transaction uses two
+buffers (log and memo), and mini-transactions may be nested. */
+constexpr size_t MAX_CACHED = 4;
+
+/** Take a heap from the arena of this thread, or create a new one if the
+arena is empty. This avoids a malloc/free pair per mini-transaction whose
+buffers outgrow their first block.
+@param[in]      loc     location of the caller
+@return empty heap */
+mem_heap_t *acquire(ut::Location loc);
+
+/** Return a heap to the arena of this thread, the heap is emptied and kept
+for the next acquire(), unless the arena is full.
+@param[in]      heap    heap to release */
+void release(mem_heap_t *heap);
+
+}  // namespace dyn_buf_arena
+
 /** Class that manages dynamic buffers. It uses a UT_LIST of
 dyn_buf_t::block_t instances. We don't use STL containers in
 order to avoid the overhead of heap calls. Using a custom memory
@@ -161,7 +187,7 @@ class dyn_buf_t {
   /** Reset the buffer vector */
   void erase() {
     if (m_heap != nullptr) {
-      mem_heap_free(m_heap);
+      dyn_buf_arena::release(m_heap);
       m_heap = nullptr;
 
       /* Initialise the list and add the first block. */
@@ -384,7 +410,7 @@ class dyn_buf_t {
     block_t *block;
 
     if (m_heap == nullptr) {
-      m_heap = mem_heap_create(sizeof(*block), UT_LOCATION_HERE);
+      m_heap = dyn_buf_arena::acquire(UT_LOCATION_HERE);
     }
 
     block = reinterpret_cast<block_t *>(mem_heap_alloc(m_heap, sizeof(*block)));
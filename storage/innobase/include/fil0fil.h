@@ -224,6 +224,11 @@ struct fil_node_t {
   /** whether atomic write is enabled for this file */
   bool atomic_write;
 
+  /** whether the device under this file guarantees untorn writes of a page,
+  see innodb_doublewrite_atomic_bypass. Pages of such files are written with
+  RWF_ATOMIC. Evaluated each time the file is opened. */
+  bool atomic_page_write;
+
   /** FIL_NODE_MAGIC_N */
   size_t magic_n;
 };
@@ -333,6 +338,7 @@ struct fil_space_t {
     new (&m_n_ref_count) std::atomic_size_t;
     new (&m_deleted) std::atomic<bool>;
 #endif /* !UNIV_HOTBACKUP */
+    new (&m_atomic_page_writes) std::atomic_bool{false};
   }
 
  private:
@@ -497,6 +503,11 @@ struct fil_space_t {
   /** Compression algorithm */
   Compression::Type compression_type;
 
+  /** true if the (single) file of this tablespace guarantees atomic page
+  writes and the doublewrite buffer is bypassed for it. Not persisted, it is
+  evaluated again each time the file is opened. */
+  std::atomic_bool m_atomic_page_writes{};
+
   /** Encryption metadata */
   Encryption_metadata m_encryption_metadata;
 
@@ -518,6 +529,22 @@ struct fil_space_t {
     return compression_type != Compression::NONE;
   }
 
+  /** Check if the pages of this tablespace can be written without the
+  doublewrite buffer because each page write is atomic on the device.
+  Transparent page compression punches holes after the write and is never
+  bypassed.
+  @return true if the doublewrite buffer can be skipped. */
+  [[nodiscard]] bool is_dblwr_bypassed() const noexcept {
+    return m_atomic_page_writes.load(std::memory_order_relaxed) &&
+           !is_compressed();
+  }
+
+  /** Record whether the file of this tablespace accepts atomic page writes.
+  @param[in]    atomic  true if page writes are atomic on the device */
+  void set_atomic_page_writes(bool atomic) noexcept {
+    m_atomic_page_writes.store(atomic, std::memory_order_relaxed);
+  }
+
   /** Check if the tablespace is encrypted.
   @return true if encrypted, false otherwise. */
   [[nodiscard]] bool is_encrypted() const noexcept {
@@ -33,6 +33,8 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #ifndef INNOBASE_FTS0TYPES_H
 #define INNOBASE_FTS0TYPES_H
 
+#include <atomic>
+
 #include "fts0fts.h"
 #include "fut0fut.h"
 #include "pars0pars.h"
@@ -135,6 +137,11 @@ struct fts_sync_t {
   bool unlock_cache; /*!< flag whether unlock cache when
                      write fts node */
   os_event_t event;  /*!< sync finish event */
+  std::atomic<bool> sync_requested;
+  /*!< true if a sync of this cache has been
+  queued for the optimize thread and not yet
+  dequeued, see
+  fts_optimize_request_sync_table() */
 };
 
 /** The cache for the FTS system. It is a memory-based inverted index
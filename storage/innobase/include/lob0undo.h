@@ -185,6 +185,9 @@ struct undo_vers_t {
     return (seq);
   }
 
+  /** @return true if no LOB undo information has been collected. */
+  bool empty() const { return m_versions == nullptr || m_versions->empty(); }
+
   /** Empty the collected LOB undo information from cache. */
   void reset() {
     if (m_versions != nullptr) {
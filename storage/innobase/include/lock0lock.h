@@ -246,6 +246,10 @@ class ReadView;
 
 extern bool innobase_deadlock_detect;
 
+/** If true, a new or changed wait-for edge wakes up the deadlock detector
+only if following the edges starting from it closes a cycle. */
+extern bool innobase_deadlock_detect_incremental;
+
 /** Gets the size of a lock struct.
  @return size in bytes */
 ulint lock_get_size(void);
@@ -886,6 +890,20 @@ void lock_wait_timeout_thread();
  so that the thread will know it has to analyze it. */
 void lock_wait_request_check_for_cycles();
 
+/** Notifies the thread which analyzes wait-for-graph that the outgoing edge
+of the given waiter was added or modified. With
+innodb_deadlock_detect_incremental the edges are followed from the waiter
+first, and the thread is notified only if they lead back to the waiter.
+@param[in]      waiter  transaction whose trx->blocking_trx has changed */
+void lock_wait_request_check_for_cycles(const trx_t *waiter);
+
+/** Checks if a change of the outgoing edge of the given waiter requires the
+thread which analyzes wait-for-graph to be notified, see
+lock_wait_request_check_for_cycles(const trx_t *).
+@param[in]      waiter  transaction whose trx->blocking_trx has changed
+@return true if lock_wait_request_check_for_cycles() should be called */
+[[nodiscard]] bool lock_wait_check_for_cycles_needed(const trx_t *waiter);
+
 /** Puts a user OS thread to wait for a lock to be released. If an error
  occurs during the wait trx->error_state associated with thr is != DB_SUCCESS
  when we return. DB_INTERRUPTED, DB_LOCK_WAIT_TIMEOUT and DB_DEADLOCK
@@ -272,10 +272,11 @@ The given log blocks must fit within the same single log file.
 @param[in]  write_size   size of the data to write (must be divisible
                          by OS_FILE_LOG_BLOCK_SIZE)
 @param[in]  buf          formatted log blocks with the data to write
+@param[in]  sync         true if the data must be durable when this returns
 @return DB_SUCCESS or error */
 dberr_t log_data_blocks_write(Log_file_handle &file_handle,
                               os_offset_t write_offset, size_t write_size,
-                              const byte *buf);
+                              const byte *buf, bool sync = false);
 
 /** Reads log blocks with redo records from the log file, starting at
 the given offset. The log blocks must exist within single log file.
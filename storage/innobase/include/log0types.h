@@ -342,9 +342,11 @@ class Log_file_handle {
   @param[in]   write_offset    offset in bytes from the beginning of the file
   @param[in]   write_size      number of bytes to write
   @param[in]   buf             buffer to write
+  @param[in]   sync            true if the written data must be durable on
+                               return (a write linked with fdatasync)
   @return DB_SUCCESS or error */
   dberr_t write(os_offset_t write_offset, os_offset_t write_size,
-                const byte *buf);
+                const byte *buf, bool sync = false);
 
   /** Executes fsync operation for this redo log file. */
   void fsync();
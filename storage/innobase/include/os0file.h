@@ -355,7 +355,15 @@ class IORequest {
     DISABLE_PUNCH_HOLE_OPTIMISATION = 2048,
 
     /** Force write of decrypted pages in encrypted tablespace. */
-    NO_ENCRYPTION = 4096
+    NO_ENCRYPTION = 4096,
+
+    /** Write the page with a single untorn write (RWF_ATOMIC). Only set for
+    files whose device guarantees atomic writes of the page size. */
+    ATOMIC_WRITE = 8192,
+
+    /** Make the written data durable before the write returns, as if the
+    write was followed by fdatasync() (RWF_DSYNC). Synchronous IO only. */
+    SYNC_WRITE = 16384
   };
 
   /** Default constructor */
@@ -457,6 +465,28 @@ class IORequest {
     }
   }
 
+  /** @return true if the write must be issued as a single atomic write */
+  [[nodiscard]] bool is_atomic_write() const {
+    return ((m_type & ATOMIC_WRITE) == ATOMIC_WRITE);
+  }
+
+  /** Set the atomic write flag */
+  void set_atomic_write() {
+    ut_ad(is_write());
+    m_type |= ATOMIC_WRITE;
+  }
+
+  /** @return true if the written data must be durable on return */
+  [[nodiscard]] bool is_sync_write() const {
+    return ((m_type & SYNC_WRITE) == SYNC_WRITE);
+  }
+
+  /** Set the sync write flag */
+  void set_sync_write() {
+    ut_ad(is_write());
+    m_type |= SYNC_WRITE;
+  }
+
   /** Clear the do not wake flag */
   void clear_do_not_wake() { m_type &= ~DO_NOT_WAKE; }
 
@@ -1932,6 +1962,16 @@ Note: On Windows we use the name and on Unices we use the file handle.
 @return true if the file system supports sparse files */
 [[nodiscard]] bool os_is_sparse_file_supported(pfs_os_file_t fh);
 
+/** Check if the device under the file guarantees that a write of the given
+size is never torn, i.e. it is either fully persisted or not at all. This
+requires the file to be opened with O_DIRECT and the atomic write unit
+reported by statx(STATX_WRITE_ATOMIC) to cover the size.
+@param[in]      fh      File handle for the file
+@param[in]      size    Size of a single write, normally the page size
+@return true if writes of size bytes can be issued with RWF_ATOMIC */
+[[nodiscard]] bool os_file_atomic_write_supported(pfs_os_file_t fh,
+                                                  ulint size);
+
 /** Decompress the page data contents. Page type must be FIL_PAGE_COMPRESSED, if
 not then the source contents are left unchanged and DB_SUCCESS is returned.
 @param[in]      dblwr_read      true of double write recovery in progress
@@ -180,6 +180,38 @@ inline int os_numa_node_of_cpu(int cpu) {
 #endif
 }
 
+/** Get the number of memory nodes in the system.
+@return number of NUMA nodes, 1 if NUMA is not supported */
+inline int os_numa_num_configured_nodes() {
+#if defined(HAVE_LIBNUMA)
+  return (numa_num_configured_nodes());
+#elif defined(HAVE_WINNUMA)
+  ULONG highest_node;
+
+  if (!GetNumaHighestNodeNumber(&highest_node)) {
+    return (1);
+  }
+
+  return (static_cast<int>(highest_node) + 1);
+#else
+  return (1);
+#endif
+}
+
+/** Restrict the calling thread to the CPUs of a given NUMA node.
+@param[in]      node    NUMA node to run on
+@return 0 on success, -1 on failure */
+inline int os_numa_run_on_node(int node) {
+#if defined(HAVE_LIBNUMA)
+  return (numa_run_on_node(node));
+#else
+  /* Not implemented on this platform, the caller is expected to carry
+  on without the affinity. */
+  (void)node;
+  return (-1);
+#endif
+}
+
 /** Allocate a memory on a given NUMA node.
 @param[in]      size    number of bytes to allocate
 @param[in]      node    NUMA node on which to allocate the memory
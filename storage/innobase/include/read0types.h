@@ -228,6 +228,11 @@ class ReadView {
   @return the low limit id */
   trx_id_t low_limit_id() const { return (m_low_limit_id); }
 
+  /**
+  @return identifier of the snapshot, assigned anew each time the view
+  is prepared or copied from another view */
+  uint64_t snapshot_id() const { return (m_snapshot_id); }
+
   /**
   @return the up limit id */
   trx_id_t up_limit_id() const noexcept { return (m_up_limit_id); }
@@ -336,6 +341,12 @@ class ReadView {
   trx_id_t m_view_low_limit_no;
 #endif /* UNIV_DEBUG */
 
+  /** Identifier of the snapshot, see snapshot_id(). */
+  uint64_t m_snapshot_id;
+
+  /** Value of trx_sys->rw_trx_ids_version when m_ids was copied. */
+  uint64_t m_ids_version;
+
   /** AC-NL-RO transaction view that has been "closed". */
   bool m_closed;
 
@@ -67,6 +67,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 class THD;
 class ha_innobase;
 class innodb_session_t;
+class Row_vers_cache;
 namespace dd {
 class Table;
 }
@@ -801,6 +802,8 @@ struct row_prebuilt_t {
                                         /decompress blob column*/
   mem_heap_t *old_vers_heap; /*!< memory heap where a previous
                              version is built in consistent read */
+  Row_vers_cache *vers_cache; /*!< versions built for the read view of
+                              the transaction, or nullptr */
   enum {
     LOCK_PCUR,
     LOCK_CLUST_PCUR,
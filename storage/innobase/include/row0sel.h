@@ -207,6 +207,18 @@ It also has optimization such as pre-caching the rows, using AHI, etc.
                                       row_prebuilt_t *prebuilt,
                                       ulint match_mode, const ulint direction);
 
+/** Return the next row of a scan if it is already in the prefetch cache or
+in the server-provided record buffer. Popping a cached row does not touch any
+shared InnoDB state, so callers can do it without entering InnoDB or going
+through the whole row_search_mvcc() path for every row of a batch.
+@param[out]     buf             buffer for the fetched row in MySQL format
+@param[in,out]  prebuilt        prebuilt struct for the table handler
+@param[in]      direction       ROW_SEL_NEXT or ROW_SEL_PREV
+@return true if a row was copied to buf, false if the caller must call
+row_search_mvcc() */
+bool row_search_pop_prefetched(byte *buf, row_prebuilt_t *prebuilt,
+                               ulint direction);
+
 /** Count rows in a R-Tree leaf level.
  @return DB_SUCCESS if successful */
 dberr_t row_count_rtree_recs(
@@ -33,6 +33,9 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #ifndef row0vers_h
 #define row0vers_h
 
+#include <deque>
+#include <unordered_map>
+
 #include "data0data.h"
 #include "dict0mem.h"
 #include "dict0types.h"
@@ -46,6 +49,96 @@ this program; if not, write to the Free Software Foundation, Inc.,
 // Forward declaration
 class ReadView;
 
+/** A bounded cache of the clustered index record versions that
+row_vers_build_for_consistent_read() built for one read view. An entry is
+keyed by the DB_TRX_ID and DB_ROLL_PTR of the latest version of the record:
+the undo log reachable from them cannot change while the view is open, so
+neither can the version the view sees. The cache empties itself whenever it
+is used with a different snapshot. */
+class Row_vers_cache {
+ public:
+  /** Identifies the latest version of a clustered index record. */
+  struct Key {
+    Key() = default;
+
+    /** Create the key of a clustered index record.
+    @param[in]  index   clustered index
+    @param[in]  rec     latest version of the record
+    @param[in]  offsets rec_get_offsets(rec, index) */
+    Key(const dict_index_t *index, const rec_t *rec, const ulint *offsets);
+
+    bool operator==(const Key &other) const {
+      return m_index_id == other.m_index_id && m_trx_id == other.m_trx_id &&
+             m_roll_ptr == other.m_roll_ptr;
+    }
+
+    space_index_t m_index_id{};
+    trx_id_t m_trx_id{};
+    roll_ptr_t m_roll_ptr{};
+  };
+
+  Row_vers_cache() = default;
+
+  ~Row_vers_cache() { clear(); }
+
+  /** Look up the version of a record that a view sees.
+  @param[in]      view          read view
+  @param[in]      key           key of rec
+  @param[in]      index         clustered index
+  @param[in]      rec           latest version of the record
+  @param[in]      offsets       rec_get_offsets(rec, index)
+  @param[in]      in_heap       heap to copy the cached version to
+  @param[out]     vers_offsets  offsets of the returned version
+  @param[in,out]  offset_heap   heap for vers_offsets
+  @return copy of the version, or nullptr if it is not cached */
+  rec_t *lookup(const ReadView *view, const Key &key, dict_index_t *index,
+                const rec_t *rec, const ulint *offsets, mem_heap_t *in_heap,
+                ulint **vers_offsets, mem_heap_t **offset_heap);
+
+  /** Remember the version of a record that a view sees.
+  @param[in]  view          read view
+  @param[in]  key           key of the latest version of the record
+  @param[in]  vers          the version visible to view
+  @param[in]  vers_offsets  rec_get_offsets(vers, index) */
+  void insert(const ReadView *view, const Key &key, const rec_t *vers,
+              const ulint *vers_offsets);
+
+ private:
+  struct Key_hash {
+    size_t operator()(const Key &key) const;
+  };
+
+  /** A copy of a record version, including its extra bytes. */
+  struct Entry {
+    byte *m_buf;
+    ulint m_extra_size;
+    ulint m_size;
+  };
+
+  /** Empty the cache if it holds versions of a different snapshot.
+  @param[in]  view  read view being served */
+  void reset_if_needed(const ReadView *view);
+
+  /** Free all the entries. */
+  void clear();
+
+  using Map = std::unordered_map<Key, Entry, Key_hash, std::equal_to<Key>,
+                                 ut::allocator<std::pair<const Key, Entry>>>;
+
+  /** Cached versions */
+  Map m_map{ut::allocator<std::pair<const Key, Entry>>(mem_key_row_vers_cache)};
+
+  /** Keys in insertion order, the oldest is evicted first */
+  std::deque<Key, ut::allocator<Key>> m_fifo{
+      ut::allocator<Key>(mem_key_row_vers_cache)};
+
+  /** Total size of the cached record copies in bytes */
+  ulint m_size{};
+
+  /** ReadView::snapshot_id() of the cached versions */
+  uint64_t m_snapshot_id{};
+};
+
 /** Finds out if an active transaction has inserted or modified a secondary
  index record.
  @param[in]   rec       record in a secondary index
@@ -112,11 +205,14 @@ bool row_vers_old_has_index_entry(
                           was freshly inserted afterwards.
  @param[out]   vrow   reports virtual column info if any
  @param[in]   lob_undo   undo log to be applied to blobs.
+ @param[in,out]   cache   cache of versions already built for the view, or
+                          nullptr
  @return DB_SUCCESS or DB_MISSING_HISTORY */
 dberr_t row_vers_build_for_consistent_read(
     const rec_t *rec, mtr_t *mtr, dict_index_t *index, ulint **offsets,
     ReadView *view, mem_heap_t **offset_heap, mem_heap_t *in_heap,
-    rec_t **old_vers, const dtuple_t **vrow, lob::undo_vers_t *lob_undo);
+    rec_t **old_vers, const dtuple_t **vrow, lob::undo_vers_t *lob_undo,
+    Row_vers_cache *cache = nullptr);
 
 /** Constructs the last committed version of a clustered index record,
  which should be seen by a semi-consistent read.
@@ -144,6 +144,11 @@ enum monitor_id_t {
   MONITOR_DEADLOCK,
   MONITOR_DEADLOCK_FALSE_POSITIVES,
   MONITOR_DEADLOCK_ROUNDS,
+  MONITOR_DEADLOCK_EDGE_WALKS,
+  MONITOR_DEADLOCK_EDGE_WALK_STEPS,
+  MONITOR_DEADLOCK_CYCLE_LENGTH,
+  MONITOR_DEADLOCK_PASS_TIME,
+  MONITOR_LOCK_REC_BATCHED_EDGES,
   MONITOR_LOCK_THREADS_WAITING,
   MONITOR_TIMEOUT,
   MONITOR_LOCKREC_WAIT,
@@ -216,6 +221,8 @@ enum monitor_id_t {
 
   MONITOR_LRU_GET_FREE_LOOPS,
   MONITOR_LRU_GET_FREE_WAITS,
+  MONITOR_LRU_MANAGER_FREE_PAGES,
+  MONITOR_LRU_MANAGER_FREE_PAGE_RATE,
 
   MONITOR_FLUSH_AVG_PAGE_RATE,
   MONITOR_FLUSH_LSN_AVG_RATE,
@@ -315,6 +322,9 @@ enum monitor_id_t {
   MONITOR_TRX_ROLLBACK_ACTIVE,
   MONITOR_TRX_ACTIVE,
   MONITOR_TRX_ALLOCATIONS,
+  MONITOR_TRX_VIEW_REUSED,
+  MONITOR_VERS_CACHE_HIT,
+  MONITOR_VERS_CACHE_MISS,
   MONITOR_TRX_ON_LOG_NO_WAITS,
   MONITOR_TRX_ON_LOG_WAITS,
   MONITOR_TRX_ON_LOG_WAIT_LOOPS,
@@ -329,6 +339,7 @@ enum monitor_id_t {
   MONITOR_N_UPD_EXIST_EXTERN,
   MONITOR_PURGE_INVOKED,
   MONITOR_PURGE_N_PAGE_HANDLED,
+  MONITOR_PURGE_UNDO_PREFETCH,
   MONITOR_DML_PURGE_DELAY,
   MONITOR_PURGE_STOP_COUNT,
   MONITOR_PURGE_RESUME_COUNT,
@@ -422,6 +433,7 @@ enum monitor_id_t {
   MONITOR_INDEX_REORG_ATTEMPTS,
   MONITOR_INDEX_REORG_SUCCESSFUL,
   MONITOR_INDEX_DISCARD,
+  MONITOR_MRR_PAGES_PREFETCHED,
 
   /* Adaptive Hash Index related counters */
   MONITOR_MODULE_ADAPTIVE_HASH,
@@ -448,6 +460,7 @@ enum monitor_id_t {
   MONITOR_OVLD_IBUF_MERGE_DISCARD_PURGE,
   MONITOR_OVLD_IBUF_MERGES,
   MONITOR_OVLD_IBUF_SIZE,
+  MONITOR_IBUF_SWEEP_MERGE_PAGES,
 
   /* Counters for server operations */
   MONITOR_MODULE_SERVER,
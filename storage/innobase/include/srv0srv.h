@@ -355,6 +355,9 @@ and/or load it during startup. */
 extern bool srv_buffer_pool_dump_at_shutdown;
 extern bool srv_buffer_pool_load_at_startup;
 
+/** Number of threads issuing the reads of a buffer pool load */
+extern ulong srv_buf_load_threads;
+
 /* Whether to disable file system cache if it is defined */
 extern bool srv_disable_sort_file_cache;
 
@@ -424,6 +427,10 @@ Currently we support native aio on windows and linux */
 extern bool srv_use_native_aio;
 extern bool srv_numa_interleave;
 
+/** If true, bind the memory of each buffer pool instance to a single NUMA
+node, and run the threads serving that instance on the same node. */
+extern bool srv_numa_node_affinity;
+
 /* The innodb_directories variable value. This a list of directories
 deliminated by ';', i.e the FIL_PATH_SEPARATOR. */
 extern char *srv_innodb_directories;
@@ -452,6 +459,13 @@ extern bool srv_undo_log_encrypt;
 /** Enable or disable encryption of temporary tablespace.*/
 extern bool srv_tmp_tablespace_encrypt;
 
+/** Whether to count sampled buffer pool page accesses per index. */
+extern bool srv_sample_index_accesses;
+
+/** Size in megabytes by which session temporary tablespaces are extended,
+or 0 to extend them like file-per-table tablespaces. */
+extern ulong srv_session_temp_extend_increment;
+
 /** Enable this option to encrypt system tablespace at bootstrap. */
 extern bool srv_sys_tablespace_encrypt;
 
@@ -501,6 +515,10 @@ extern ulong srv_log_write_max_size;
 /** Size of block, used for writing ahead to avoid read-on-write. */
 extern ulong srv_log_write_ahead_size;
 
+/** Whether the log writer makes each redo write durable itself (a write
+linked with fdatasync), when innodb_flush_log_at_trx_commit = 1. */
+extern bool srv_log_writer_sync_write;
+
 /** Number of events used for notifications about redo write. */
 extern ulong srv_log_write_events;
 
@@ -634,6 +652,9 @@ extern bool srv_validate_tablespace_paths;
 extern bool srv_use_fdatasync;
 /** Scan depth for LRU flush batch i.e.: number of blocks scanned*/
 extern ulong srv_LRU_scan_depth;
+/** Number of evicted page ids remembered per buffer pool instance to detect
+pages evicted too early, 0 disables the ghost list */
+extern ulong srv_LRU_ghost_list_size;
 /** Whether or not to flush neighbors of a block */
 extern ulong srv_flush_neighbors;
 /** Previously requested size. Accesses protected by memory barriers. */
@@ -736,6 +757,9 @@ extern ulong srv_force_recovery;
 extern ulong srv_force_recovery_crash;
 #endif /* UNIV_DEBUG */
 
+/** Number of threads applying redo records to pages in a recovery batch */
+extern ulong srv_recv_apply_threads;
+
 /** The value of the configuration parameter innodb_fast_shutdown,
 controlling the InnoDB shutdown.
 
@@ -755,6 +779,9 @@ extern unsigned long long srv_stats_transient_sample_pages;
 extern bool srv_stats_persistent;
 extern unsigned long long srv_stats_persistent_sample_pages;
 extern bool srv_stats_auto_recalc;
+/** Maximum number of index pages per second the background statistics
+thread may sample, 0 for no limit */
+extern ulong srv_stats_auto_recalc_pages_per_sec;
 extern bool srv_stats_include_delete_marked;
 
 extern ulong srv_checksum_algorithm;
@@ -866,6 +893,21 @@ extern ulong srv_n_purge_threads;
 /* the number of pages to purge in one batch */
 extern ulong srv_purge_batch_size;
 
+/** If true, purge reads the undo pages it will need next asynchronously. */
+extern bool srv_purge_undo_prefetch;
+
+/** If true, DS-MRR reads in the clustered index leaf pages of a sorted
+batch of primary keys before fetching the rows */
+extern bool srv_mrr_prefetch;
+
+/** If true, plain locking SELECTs may prefetch rows into the record
+buffer, see row_prebuilt_t::can_prefetch_records() */
+extern bool srv_prefetch_locking_reads;
+
+/** Maximum size in bytes of the record versions that a table handle caches
+for its consistent read view, 0 to disable the cache */
+extern ulong srv_cons_read_vers_cache_size;
+
 /* the number of sync wait arrays */
 extern ulong srv_sync_array_size;
 
@@ -904,6 +946,7 @@ extern srv_stats_t srv_stats;
 extern mysql_pfs_key_t log_archiver_thread_key;
 extern mysql_pfs_key_t page_archiver_thread_key;
 extern mysql_pfs_key_t buf_dump_thread_key;
+extern mysql_pfs_key_t buf_load_thread_key;
 extern mysql_pfs_key_t buf_lru_manager_thread_key;
 extern mysql_pfs_key_t buf_resize_thread_key;
 extern mysql_pfs_key_t clone_ddl_thread_key;
@@ -934,6 +977,7 @@ extern mysql_pfs_key_t trx_recovery_rollback_thread_key;
 extern mysql_pfs_key_t srv_ts_alter_encrypt_thread_key;
 extern mysql_pfs_key_t parallel_read_thread_key;
 extern mysql_pfs_key_t parallel_rseg_init_thread_key;
+extern mysql_pfs_key_t recv_apply_thread_key;
 #endif /* UNIV_PFS_THREAD */
 #endif /* !UNIV_HOTBACKUP */
 
@@ -420,6 +420,11 @@ struct rw_lock_t
   /** Line number where last time x-locked */
   uint16_t last_x_line;
 
+  /** Moving average, in 1/16 rounds, of the spin rounds after which waits
+  for this lock were granted; decays towards 0 when spinning did not help
+  and the waiter had to be suspended. May not be accurate */
+  std::atomic<uint16_t> spin_rounds;
+
   /** Count of os_waits. May not be accurate */
   uint32_t count_os_wait;
 
@@ -554,6 +554,12 @@ struct trx_sys_t {
   releasing locks to ensure right order of removal and consistent snapshot. */
   trx_ids_t rw_trx_ids;
 
+  /** Incremented, while holding trx_sys->mutex, every time rw_trx_ids
+  changes. A closed ReadView whose snapshot of this counter is still
+  current can be reopened by an AC-NL-RO transaction without taking
+  trx_sys->mutex. */
+  std::atomic<uint64_t> rw_trx_ids_version;
+
   char pad7[ut::INNODB_CACHE_LINE_SIZE];
 
   /** Mapping from transaction id to transaction instance. */
@@ -1168,6 +1168,11 @@ struct trx_t {
   is rolled back down to this undo
   number; see note at undo_mutex! */
   trx_rsegs_t rsegs;    /* rollback segments for undo logging */
+  ulint rseg_slot_hint; /*!< slot of the durable rollback segment
+                        used by the previous transaction of this
+                        trx object, or ULINT_UNDEFINED; tried first
+                        so that a connection keeps using the same
+                        rseg and its cached undo segments */
   undo_no_t roll_limit; /*!< least undo number to undo during
                         a partial rollback; 0 otherwise */
 #ifdef UNIV_DEBUG
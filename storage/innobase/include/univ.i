@@ -374,7 +374,7 @@ constexpr uint32_t MAX_FULL_NAME_LEN =
     MAX_TABLE_NAME_LEN + MAX_DATABASE_NAME_LEN + 14;
 
 /** Maximum length of the compression algorithm string. Currently we support
-only (NONE | ZLIB | LZ4). */
+only (NONE | ZLIB | LZ4 | ZSTD). */
 constexpr uint32_t MAX_COMPRESSION_LEN = 4;
 
 /*
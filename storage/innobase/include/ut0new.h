@@ -126,6 +126,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include <memory>
 #include <set>
 #include <type_traits> /* std::is_trivially_default_constructible */
+#include <unordered_map>
 #include <unordered_set>
 
 #include "my_basename.h"
@@ -222,6 +223,7 @@ extern PSI_memory_key mem_key_redo_log_archive_queue_element;
 extern PSI_memory_key mem_key_other;
 extern PSI_memory_key mem_key_partitioning;
 extern PSI_memory_key mem_key_row_log_buf;
+extern PSI_memory_key mem_key_row_vers_cache;
 extern PSI_memory_key mem_key_ddl;
 extern PSI_memory_key mem_key_std;
 extern PSI_memory_key mem_key_trx_sys_t_rw_trx_ids;
@@ -2905,6 +2907,12 @@ using unordered_set =
     std::unordered_set<Key, std::hash<Key>, std::equal_to<Key>,
                        ut::allocator<Key>>;
 
+/** Specialization of unordered_map which uses ut_allocator. */
+template <typename Key, typename Value>
+using unordered_map =
+    std::unordered_map<Key, Value, std::hash<Key>, std::equal_to<Key>,
+                       ut::allocator<std::pair<const Key, Value>>>;
+
 /** Specialization of map which uses ut_allocator. */
 template <typename Key, typename Value, typename Compare = std::less<Key>>
 using map =
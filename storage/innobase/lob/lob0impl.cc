@@ -25,6 +25,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 *****************************************************************************/
 
 #include "lob0impl.h"
+#include "buf0rea.h"
 #include "lob0del.h"
 #include "lob0index.h"
 #include "lob0inf.h"
@@ -1063,6 +1064,9 @@ dberr_t insert(InsertContext *ctx, trx_t *trx, ref_t &ref,
   return ret;
 }
 
+/** Number of LOB data pages to request ahead of the one being copied. */
+static constexpr ulint LOB_READ_AHEAD_PAGES = 8;
+
 /** Fetch a large object (LOB) from the system.
 @param[in]  ctx    the read context information.
 @param[in]  ref    the LOB reference identifying the LOB.
@@ -1157,9 +1161,38 @@ ulint read(ReadContext *ctx, ref_t ref, ulint offset, ulint len, byte *buf) {
   const ulint commit_freq = 10;
   ulint data_pages_count = 0;
 
+  /* The data pages of a LOB are read one at a time below. For a LOB that
+  spans many pages, keep LOB_READ_AHEAD_PAGES asynchronous reads in flight
+  ahead of the copy. Entries of a newer LOB version than the one being read
+  are not followed into their version lists, they are just skipped. */
+  const bool read_ahead =
+      want > LOB_READ_AHEAD_PAGES * ctx->m_page_size.physical();
+  index_entry_t ahead_entry(&mtr, ctx->m_index);
+  fil_addr_t ahead_loc = node_loc;
+  ulint n_ahead = 0;
+
   while (!fil_addr_is_null(node_loc) && want > 0) {
     old_version.reset(nullptr);
 
+    while (read_ahead && n_ahead < LOB_READ_AHEAD_PAGES &&
+           !fil_addr_is_null(ahead_loc)) {
+      ahead_entry.reset(first_page.addr2ptr_s_cache(cached_blocks, ahead_loc));
+
+      const page_no_t ahead_page_no = ahead_entry.get_page_no();
+
+      if (ahead_entry.get_lob_version() <= lob_version &&
+          ahead_page_no != FIL_NULL && ahead_page_no != first_page_no) {
+        const page_id_t ahead_page_id(ctx->m_space_id, ahead_page_no);
+
+        if (!buf_page_peek(ahead_page_id)) {
+          buf_read_page_background(ahead_page_id, ctx->m_page_size, false);
+        }
+      }
+
+      ahead_loc = ahead_entry.get_next();
+      ++n_ahead;
+    }
+
     node = first_page.addr2ptr_s_cache(cached_blocks, node_loc);
     cur_entry.reset(node);
 
@@ -1230,6 +1263,10 @@ ulint read(ReadContext *ctx, ref_t ref, ulint offset, ulint len, byte *buf) {
     total_read += actual_read;
     page_offset = 0;
     node_loc = cur_entry.get_next();
+
+    if (n_ahead > 0) {
+      --n_ahead;
+    }
   }
 
   /* Assert that we have read what has been requested or what is
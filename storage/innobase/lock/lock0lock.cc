@@ -68,6 +68,8 @@ this program; if not, write to the Free Software Foundation, Inc.,
 /* Flag to enable/disable deadlock detector. */
 bool innobase_deadlock_detect = true;
 
+bool innobase_deadlock_detect_incremental = false;
+
 /** Total number of cached record locks */
 static const ulint REC_LOCK_CACHE = 8;
 
@@ -685,10 +687,20 @@ if none found */
 ulint lock_rec_find_next_set_bit(const lock_t *lock, ulint heap_no) {
   ut_ad(heap_no != ULINT_UNDEFINED);
 
-  for (ulint i = heap_no + 1; i < lock_rec_get_n_bits(lock); ++i) {
+  const byte *bitmap = (const byte *)&lock[1];
+  const ulint n = lock_rec_get_n_bits(lock);
+  ut_ad(n % 8 == 0);
+
+  for (ulint i = heap_no + 1; i < n;) {
+    /* Skip whole bytes of the bitmap with no bit set. */
+    if (i % 8 == 0 && bitmap[i / 8] == 0) {
+      i += 8;
+      continue;
+    }
     if (lock_rec_get_nth_bit(lock, i)) {
       return (i);
     }
+    ++i;
   }
 
   return (ULINT_UNDEFINED);
@@ -2129,22 +2141,35 @@ makes sure that the (only) edge in the wait-for graph outgoing from the
 waiting_lock->trx points to blocking_lock->trx
 @param[in]    waiting_lock    A lock waiting in queue, blocked by blocking_lock
 @param[in]    blocking_lock   A lock which is a reason the waiting_lock has to
-                              wait */
-static void lock_update_wait_for_edge(const lock_t *waiting_lock,
-                                      const lock_t *blocking_lock) {
+                              wait
+@param[in]    notify          true if the thread analyzing the wait-for graph
+                              should be notified here about the changed edge,
+                              false if the caller will do it (once for a batch
+                              of edges)
+@return true if the edge has changed and the thread analyzing the wait-for
+graph needs to be notified (when notify is false) */
+static bool lock_update_wait_for_edge(const lock_t *waiting_lock,
+                                      const lock_t *blocking_lock,
+                                      bool notify = true) {
   ut_ad(locksys::owns_lock_shard(waiting_lock));
   ut_ad(locksys::owns_lock_shard(blocking_lock));
   ut_ad(waiting_lock->is_waiting());
   ut_ad(lock_has_to_wait(waiting_lock, blocking_lock));
+  bool request_check = false;
   /* Still needs to wait, but perhaps the reason has changed */
   if (waiting_lock->trx->lock.blocking_trx.load() != blocking_lock->trx) {
     waiting_lock->trx->lock.blocking_trx.store(blocking_lock->trx);
     /* We call lock_wait_request_check_for_cycles() because the outgoing edge of
     wait_lock->trx has changed it's endpoint and we need to analyze the
     wait-for-graph again. */
-    lock_wait_request_check_for_cycles();
+    if (notify) {
+      lock_wait_request_check_for_cycles(waiting_lock->trx);
+    } else {
+      request_check = lock_wait_check_for_cycles_needed(waiting_lock->trx);
+    }
     lock_report_wait_for_edge_to_server(waiting_lock, blocking_lock);
   }
+  return request_check;
 }
 
 /** Checks if a waiting record lock request still has to wait for granted locks.
@@ -2302,6 +2327,12 @@ static void lock_rec_grant_by_heap_no(lock_t *in_lock, ulint heap_no) {
 
   granted.reserve(granted.size() + waiting.size());
 
+  /* On a hot row all the other waiters now wait for the trx granted first.
+  Their edges are updated in a batch and the thread analyzing the wait-for
+  graph is notified once, instead of once per waiter on every release. */
+  bool request_check = false;
+  size_t n_updated_edges = 0;
+
   for (lock_t *wait_lock : waiting) {
     /* Check if the transactions in the waiting queue have
     to wait for locks granted above. If they don't have to
@@ -2321,9 +2352,20 @@ static void lock_rec_grant_by_heap_no(lock_t *in_lock, ulint heap_no) {
 
       granted.push_back(wait_lock);
     } else {
-      lock_update_wait_for_edge(wait_lock, blocking_lock);
+      if (lock_update_wait_for_edge(wait_lock, blocking_lock, false)) {
+        request_check = true;
+      }
+      ++n_updated_edges;
     }
   }
+
+  if (request_check) {
+    lock_wait_request_check_for_cycles();
+  }
+
+  if (n_updated_edges > 1) {
+    MONITOR_INC_VALUE(MONITOR_LOCK_REC_BATCHED_EDGES, n_updated_edges);
+  }
 }
 
 /* Forward declaration to minimize the diff */
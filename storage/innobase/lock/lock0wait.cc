@@ -186,7 +186,7 @@ static srv_slot_t *lock_wait_table_reserve_slot(
       visible.
       I hope this explains why we do waste time on calling
       lock_wait_request_check_for_cycles() from lock_create_wait_for_edge().*/
-      lock_wait_request_check_for_cycles();
+      lock_wait_request_check_for_cycles(thr_get_trx(thr));
       return (slot);
     }
   }
@@ -241,6 +241,52 @@ static void print_lock_wait_timeout(const trx_t &trx,
 
 void lock_wait_request_check_for_cycles() { lock_set_timeout_event(); }
 
+/** Maximum number of edges followed by lock_wait_edge_may_close_cycle() */
+static constexpr size_t LOCK_WAIT_MAX_EDGE_WALK = 256;
+
+/** Follows the wait-for edges starting from the outgoing edge of the waiter,
+to check if this edge could have closed a deadlock cycle. The edges are read
+without any latch, so the answer is only a hint: trx_t objects are never
+freed while the server runs, and each thread first stores its own edge and
+only then follows the edges, so of the threads closing a cycle concurrently
+at least the last one sees all of its edges. Anything missed is found by the
+periodic scan of the whole graph.
+@param[in]      waiter  transaction whose outgoing edge was added or changed
+@return true if the edges lead back to the waiter or the walk was too long to
+tell, false if they end at a transaction which does not wait */
+static bool lock_wait_edge_may_close_cycle(const trx_t *waiter) {
+  const trx_t *trx = waiter->lock.blocking_trx.load();
+  size_t steps = 0;
+  bool may_close = true;
+
+  for (; trx != waiter && steps < LOCK_WAIT_MAX_EDGE_WALK; ++steps) {
+    if (trx == nullptr) {
+      may_close = false;
+      break;
+    }
+
+    trx = trx->lock.blocking_trx.load();
+  }
+
+  MONITOR_INC(MONITOR_DEADLOCK_EDGE_WALKS);
+  MONITOR_INC_VALUE(MONITOR_DEADLOCK_EDGE_WALK_STEPS, steps);
+
+  return may_close;
+}
+
+bool lock_wait_check_for_cycles_needed(const trx_t *waiter) {
+  /* Without deadlock detection the thread still refreshes the schedule
+  weights on each change. */
+  return !innobase_deadlock_detect_incremental || !innobase_deadlock_detect ||
+         lock_wait_edge_may_close_cycle(waiter);
+}
+
+void lock_wait_request_check_for_cycles(const trx_t *waiter) {
+  if (lock_wait_check_for_cycles_needed(waiter)) {
+    lock_set_timeout_event();
+  }
+}
+
 void lock_wait_suspend_thread(que_thr_t *thr) {
   srv_slot_t *slot;
   trx_t *trx;
@@ -1381,6 +1427,7 @@ static void lock_wait_find_and_handle_deadlocks(
       if (colors[id] == current_color) {
         /* found a candidate cycle! */
         lock_wait_extract_cycle_ids(cycle_ids, id, outgoing);
+        MONITOR_SET(MONITOR_DEADLOCK_CYCLE_LENGTH, cycle_ids.size());
         if (lock_wait_check_candidate_cycle(cycle_ids, infos, new_weights)) {
           MONITOR_INC(MONITOR_DEADLOCK);
         } else {
@@ -1492,6 +1539,8 @@ static void lock_wait_update_schedule_and_check_for_deadlocks() {
   ut::vector<int> outgoing;
   ut::vector<trx_schedule_weight_t> new_weights;
 
+  const auto start_time = std::chrono::steady_clock::now();
+
   auto table_reservations = lock_wait_snapshot_waiting_threads(infos);
   lock_wait_build_wait_for_graph(infos, outgoing);
 
@@ -1503,6 +1552,11 @@ static void lock_wait_update_schedule_and_check_for_deadlocks() {
     /* This will also update trx->lock.schedule_weight for trxs on cycles. */
     lock_wait_find_and_handle_deadlocks(infos, outgoing, new_weights);
   }
+
+  MONITOR_SET(MONITOR_DEADLOCK_PASS_TIME,
+              std::chrono::duration_cast<std::chrono::microseconds>(
+                  std::chrono::steady_clock::now() - start_time)
+                  .count());
 }
 
 /** A thread which wakes up threads whose lock wait may have lasted too long,
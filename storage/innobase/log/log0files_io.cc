@@ -369,12 +369,17 @@ dberr_t Log_file_handle::read(os_offset_t read_offset, os_offset_t read_size,
 }
 
 dberr_t Log_file_handle::write(os_offset_t write_offset, os_offset_t write_size,
-                               const byte *buf) {
+                               const byte *buf, bool sync) {
   if (!is_open()) return DB_ERROR;
 
   auto io_request = prepare_io_request(IORequest::WRITE, write_offset,
                                        write_size, srv_redo_log_encrypt);
 
+  if (sync && !s_skip_fsyncs) {
+    s_total_fsyncs.fetch_add(1, std::memory_order_relaxed);
+    io_request.set_sync_write();
+  }
+
   ut_ad(m_access_mode != Log_file_access_mode::READ_ONLY);
 
   if (s_on_before_write) {
@@ -676,9 +681,9 @@ static void log_data_blocks_validate(os_offset_t offset, os_offset_t size) {
 
 dberr_t log_data_blocks_write(Log_file_handle &file_handle,
                               os_offset_t write_offset, size_t write_size,
-                              const byte *buf) {
+                              const byte *buf, bool sync) {
   log_data_blocks_validate(write_offset, write_size);
-  return file_handle.write(write_offset, write_size, buf);
+  return file_handle.write(write_offset, write_size, buf, sync);
 }
 
 dberr_t log_data_blocks_read(Log_file_handle &file_handle,
@@ -1043,6 +1043,39 @@ static void recv_apply_log_rec(recv_addr_t *recv_addr) {
   }
 }
 
+/** Applies the redo records of a range of pages. Pages found in the buffer
+pool are applied by the calling thread, the other ones are read in with
+read-ahead and applied when the read completes. Called with recv_sys->mutex
+held, which is released while a page is being applied or read.
+@param[in]      begin           first page of the range
+@param[in]      end             end of the range
+@param[in,out]  n_applied       incremented for each page of the range */
+static void recv_apply_log_recs_range(recv_addr_t *const *begin,
+                                      recv_addr_t *const *end,
+                                      std::atomic<size_t> *n_applied) {
+  ut_ad(mutex_own(&recv_sys->mutex));
+
+  for (auto it = begin; it != end; ++it) {
+    recv_apply_log_rec(*it);
+
+    n_applied->fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+/** Recovery apply worker thread, applies a range of pages.
+@param[in]      begin           first page of the range
+@param[in]      end             end of the range
+@param[in,out]  n_applied       incremented for each page of the range */
+static void recv_apply_thread(recv_addr_t *const *begin,
+                              recv_addr_t *const *end,
+                              std::atomic<size_t> *n_applied) {
+  mutex_enter(&recv_sys->mutex);
+
+  recv_apply_log_recs_range(begin, end, n_applied);
+
+  mutex_exit(&recv_sys->mutex);
+}
+
 dberr_t recv_apply_hashed_log_recs(log_t &log, bool allow_ibuf) {
   for (;;) {
     mutex_enter(&recv_sys->mutex);
@@ -1070,7 +1103,6 @@ dberr_t recv_apply_hashed_log_recs(log_t &log, bool allow_ibuf) {
   static const size_t PCT = 10;
 
   size_t pct = PCT;
-  size_t applied = 0;
   auto unit = batch_size / PCT;
 
   if (unit <= PCT) {
@@ -1080,6 +1112,13 @@ dberr_t recv_apply_hashed_log_recs(log_t &log, bool allow_ibuf) {
 
   auto start_time = std::chrono::steady_clock::now();
 
+  /* Pages of all tablespaces, grouped by tablespace and sorted by page
+  number, so that each apply thread works on a disjoint set of neighbouring
+  pages and the read-ahead areas rarely span two threads. */
+  std::vector<recv_addr_t *, ut::allocator<recv_addr_t *>> recv_addrs;
+
+  recv_addrs.reserve(batch_size);
+
   for (const auto &space : *recv_sys->spaces) {
     bool dropped;
 
@@ -1105,6 +1144,8 @@ dberr_t recv_apply_hashed_log_recs(log_t &log, bool allow_ibuf) {
       }
     }
 
+    const auto space_begin = recv_addrs.size();
+
     for (auto pages : space.second.m_pages) {
       ut_ad(pages.second->space == space.first);
 
@@ -1112,28 +1153,78 @@ dberr_t recv_apply_hashed_log_recs(log_t &log, bool allow_ibuf) {
         pages.second->state = RECV_DISCARDED;
       }
 
-      recv_apply_log_rec(pages.second);
+      recv_addrs.push_back(pages.second);
+    }
 
-      ++applied;
+    std::sort(recv_addrs.begin() + space_begin, recv_addrs.end(),
+              [](const recv_addr_t *lhs, const recv_addr_t *rhs) {
+                return lhs->page_no < rhs->page_no;
+              });
+  }
 
-      if (unit == 0 || (applied % unit) == 0) {
-        ib::info(ER_IB_MSG_708) << pct << "%";
+  /* Records of different pages are independent: the file operations were
+  applied while parsing, so the pages can be split between threads. */
+  const size_t n_threads = std::max<size_t>(
+      1, std::min<size_t>(srv_recv_apply_threads,
+                          recv_addrs.size() / RECV_READ_AHEAD_AREA));
 
-        pct += PCT;
+  const size_t range_n = (recv_addrs.size() + n_threads - 1) / n_threads;
 
-        start_time = std::chrono::steady_clock::now();
+  std::atomic<size_t> n_applied{0};
 
-      } else if (std::chrono::steady_clock::now() - start_time >=
-                 PRINT_INTERVAL) {
-        start_time = std::chrono::steady_clock::now();
+  std::vector<IB_thread, ut::allocator<IB_thread>> threads;
 
-        ib::info(ER_IB_MSG_709)
-            << std::setprecision(2)
-            << ((double)applied * 100) / (double)batch_size << "%";
-      }
+  mutex_exit(&recv_sys->mutex);
+
+  for (size_t i = 1; i < n_threads; ++i) {
+    const auto begin = std::min(recv_addrs.size(), i * range_n);
+    const auto end = std::min(recv_addrs.size(), begin + range_n);
+
+    auto thread = os_thread_create(recv_apply_thread_key, i, recv_apply_thread,
+                                   recv_addrs.data() + begin,
+                                   recv_addrs.data() + end, &n_applied);
+    threads.push_back(thread);
+    thread.start();
+  }
+
+  mutex_enter(&recv_sys->mutex);
+
+  /* This thread applies the first range and reports the progress of all. */
+  const auto own_end = std::min(recv_addrs.size(), range_n);
+
+  size_t report_at = unit;
+
+  for (size_t i = 0; i < own_end; ++i) {
+    recv_apply_log_recs_range(&recv_addrs[i], &recv_addrs[i] + 1, &n_applied);
+
+    const auto applied = n_applied.load(std::memory_order_relaxed);
+
+    if (unit == 0 || applied >= report_at) {
+      ib::info(ER_IB_MSG_708) << pct << "%";
+
+      pct += PCT;
+      report_at += unit;
+
+      start_time = std::chrono::steady_clock::now();
+
+    } else if (std::chrono::steady_clock::now() - start_time >=
+               PRINT_INTERVAL) {
+      start_time = std::chrono::steady_clock::now();
+
+      ib::info(ER_IB_MSG_709)
+          << std::setprecision(2)
+          << ((double)applied * 100) / (double)batch_size << "%";
     }
   }
 
+  mutex_exit(&recv_sys->mutex);
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  mutex_enter(&recv_sys->mutex);
+
   /* Wait until all the pages have been processed */
 
   while (recv_sys->n_addrs != 0) {
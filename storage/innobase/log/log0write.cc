@@ -745,6 +745,12 @@ and log flush_notifier thread is not notified! (optimization)
 @param[in,out]  log   redo log */
 static void log_flush_low(log_t &log);
 
+/** Advances log.flushed_to_disk_lsn to the given lsn, unless it has already
+been advanced further, and notifies users waiting in log.flush_events.
+@param[in,out]  log      redo log
+@param[in]      new_lsn  redo is durable up to this lsn */
+static void log_advance_flushed_to_disk_lsn(log_t &log, lsn_t new_lsn);
+
 /**************************************************/ /**
 
  @name Waiting for redo log written or flushed up to lsn
@@ -1563,7 +1569,8 @@ static inline void prepare_full_blocks(const log_t &log, byte *buffer,
 }
 
 static inline dberr_t write_blocks(log_t &log, byte *write_buf,
-                                   size_t write_size, os_offset_t real_offset) {
+                                   size_t write_size, os_offset_t real_offset,
+                                   bool sync) {
   ut_a(write_size >= OS_FILE_LOG_BLOCK_SIZE);
   ut_a(write_size % OS_FILE_LOG_BLOCK_SIZE == 0);
   ut_a(real_offset / UNIV_PAGE_SIZE <= PAGE_NO_MAX);
@@ -1573,8 +1580,9 @@ static inline dberr_t write_blocks(log_t &log, byte *write_buf,
   ut_a(real_offset + write_size <= log.write_ahead_end_offset ||
        (real_offset + write_size) % srv_log_write_ahead_size == 0);
 
-  const dberr_t err = log_data_blocks_write(log.m_current_file_handle,
-                                            real_offset, write_size, write_buf);
+  const dberr_t err =
+      log_data_blocks_write(log.m_current_file_handle, real_offset, write_size,
+                            write_buf, sync);
 
   if (err != DB_SUCCESS) {
     return err;
@@ -1587,9 +1595,12 @@ static inline dberr_t write_blocks(log_t &log, byte *write_buf,
 
 static inline void notify_about_advanced_write_lsn(log_t &log,
                                                    lsn_t old_write_lsn,
-                                                   lsn_t new_write_lsn) {
+                                                   lsn_t new_write_lsn,
+                                                   bool flushed) {
   if (!log.writer_threads_paused.load(std::memory_order_acquire)) {
-    if (srv_flush_log_at_trx_commit == 1) {
+    /* The log flusher has nothing to do when the log writer advances the
+    flushed lsn itself. */
+    if (srv_flush_log_at_trx_commit == 1 && !flushed) {
       os_event_set(log.flusher_event);
     }
 
@@ -1716,6 +1727,15 @@ static inline void update_current_write_ahead(log_t &log,
 
 }  // namespace Log_files_write_impl
 
+/** Checks if the log writer makes the redo durable itself, writing it with
+a write linked with fdatasync() (or through O_DSYNC), so that users waiting
+for the flush are notified directly when the write completes, instead of
+after the hand-off to the log flusher.
+@return true if writes done by the log writer are durable on return */
+static inline bool log_writer_writes_durably() {
+  return srv_log_writer_sync_write && srv_flush_log_at_trx_commit == 1;
+}
+
 static dberr_t log_write_buffer(log_t &log, byte *buffer, size_t buffer_size,
                                 lsn_t start_lsn) {
   ut_ad(log_writer_mutex_own(log));
@@ -1784,9 +1804,19 @@ static dberr_t log_write_buffer(log_t &log, byte *buffer, size_t buffer_size,
 
   srv_stats.os_log_pending_writes.inc();
 
+  const bool durable = log_writer_writes_durably();
+
+#ifndef _WIN32
+  /* With O_DSYNC every write is durable already. */
+  const bool sync = durable && srv_unix_file_flush_method != SRV_UNIX_O_DSYNC;
+#else
+  const bool sync = durable;
+#endif /* !_WIN32 */
+
   /* Now, we know, that we are going to write completed
   blocks only (originally or copied and completed). */
-  const dberr_t err = write_blocks(log, write_buf, write_size, real_offset);
+  const dberr_t err =
+      write_blocks(log, write_buf, write_size, real_offset, sync);
   if (UNIV_UNLIKELY(err != DB_SUCCESS)) {
     return err;
   }
@@ -1800,7 +1830,17 @@ static dberr_t log_write_buffer(log_t &log, byte *buffer, size_t buffer_size,
 
   log.write_lsn.store(new_write_lsn);
 
-  notify_about_advanced_write_lsn(log, old_write_lsn, new_write_lsn);
+  /* A durable write makes only its own range durable. Writes before
+  start_lsn that were not flushed yet, for example because the log writer
+  has just been switched to durable writes, are left to the log flusher,
+  which fsyncs them and advances the flushed lsn past this write too. */
+  const bool flushed = durable && log.flushed_to_disk_lsn.load() >= start_lsn;
+
+  notify_about_advanced_write_lsn(log, old_write_lsn, new_write_lsn, flushed);
+
+  if (flushed) {
+    log_advance_flushed_to_disk_lsn(log, new_write_lsn);
+  }
 
   log_sync_point("log_writer_before_buf_limit_update");
 
@@ -2412,6 +2452,40 @@ uint64_t log_total_flushes() { return Log_file_handle::total_fsyncs(); }
 
 uint64_t log_pending_flushes() { return Log_file_handle::fsyncs_in_progress(); }
 
+static void log_advance_flushed_to_disk_lsn(log_t &log, lsn_t new_lsn) {
+  lsn_t old_lsn = log.flushed_to_disk_lsn.load();
+
+  /* Both the log flusher and the log writer (for durable writes) advance
+  the flushed lsn, the larger value wins. */
+  do {
+    if (old_lsn >= new_lsn) {
+      return;
+    }
+  } while (!log.flushed_to_disk_lsn.compare_exchange_weak(old_lsn, new_lsn));
+
+  /* Notify other thread(s). */
+
+  DBUG_PRINT("ib_log", ("Flushed to disk up to " LSN_PF, new_lsn));
+
+  if (!log.writer_threads_paused.load(std::memory_order_acquire)) {
+    const auto first_slot = log_compute_flush_event_slot(log, old_lsn + 1);
+
+    const auto last_slot = log_compute_flush_event_slot(log, new_lsn);
+
+    if (first_slot == last_slot) {
+      log_sync_point("log_flush_before_users_notify");
+      os_event_set(log.flush_events[first_slot]);
+    } else {
+      log_sync_point("log_flush_before_notifier_notify");
+      os_event_set(log.flush_notifier_event);
+    }
+  } else {
+    log_sync_point("log_flush_before_users_notify");
+    log_sync_point("log_flush_before_notifier_notify");
+    os_event_set(log.old_flush_event);
+  }
+}
+
 static void log_flush_low(log_t &log) {
   ut_ad(log_flusher_mutex_own(log));
 
@@ -2456,30 +2530,9 @@ static void log_flush_low(log_t &log) {
 
   log_sync_point("log_flush_before_flushed_to_disk_lsn");
 
-  log.flushed_to_disk_lsn.store(flush_up_to_lsn);
-
-  /* Notify other thread(s). */
-
-  DBUG_PRINT("ib_log", ("Flushed to disk up to " LSN_PF, flush_up_to_lsn));
-
-  if (!log.writer_threads_paused.load(std::memory_order_acquire)) {
-    const auto first_slot =
-        log_compute_flush_event_slot(log, last_flush_lsn + 1);
-
-    const auto last_slot = log_compute_flush_event_slot(log, flush_up_to_lsn);
-
-    if (first_slot == last_slot) {
-      log_sync_point("log_flush_before_users_notify");
-      os_event_set(log.flush_events[first_slot]);
-    } else {
-      log_sync_point("log_flush_before_notifier_notify");
-      os_event_set(log.flush_notifier_event);
-    }
-  } else {
-    log_sync_point("log_flush_before_users_notify");
-    log_sync_point("log_flush_before_notifier_notify");
-    os_event_set(log.old_flush_event);
-  }
+  /* The log writer might have advanced it meanwhile, when it has been
+  switched to durable writes. */
+  log_advance_flushed_to_disk_lsn(log, flush_up_to_lsn);
 
   /* Update stats. */
 
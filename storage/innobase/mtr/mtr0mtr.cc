@@ -573,6 +573,52 @@ struct mtr_write_log_t {
 thread_local ut::unordered_set<const mtr_t *> mtr_t::s_my_thread_active_mtrs;
 #endif
 
+namespace dyn_buf_arena {
+
+/** Heaps cached by one thread, freed when the thread exits. */
+struct Arena {
+  ~Arena() {
+    while (m_n_cached > 0) {
+      mem_heap_free(m_cached[--m_n_cached]);
+    }
+  }
+
+  /** Cached, empty heaps */
+  std::array<mem_heap_t *, MAX_CACHED> m_cached{};
+
+  /** Number of heaps in m_cached */
+  size_t m_n_cached{};
+};
+
+static thread_local Arena tl_arena;
+
+mem_heap_t *acquire(ut::Location loc) {
+  auto &arena = tl_arena;
+
+  if (arena.m_n_cached > 0) {
+    return arena.m_cached[--arena.m_n_cached];
+  }
+
+  return mem_heap_create(HEAP_SIZE, loc);
+}
+
+void release(mem_heap_t *heap) {
+  auto &arena = tl_arena;
+
+  if (arena.m_n_cached == MAX_CACHED) {
+    mem_heap_free(heap);
+    return;
+  }
+
+  /* Keeps only the first block, blocks added for larger buffers are freed
+  so that the cache of a thread stays bounded. */
+  mem_heap_empty(heap);
+
+  arena.m_cached[arena.m_n_cached++] = heap;
+}
+
+}  // namespace dyn_buf_arena
+
 void mtr_t::start(bool sync) {
   ut_ad(m_impl.m_state == MTR_STATE_INIT ||
         m_impl.m_state == MTR_STATE_COMMITTED);
@@ -67,7 +67,9 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA
 #endif /* _WIN32 */
 
 #ifdef __linux__
+#include <fcntl.h>
 #include <sys/sendfile.h>
+#include <sys/uio.h>
 #endif /* __linux__ */
 
 #ifdef LINUX_NATIVE_AIO
@@ -85,6 +87,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA
 
 #include <errno.h>
 #include <lz4.h>
+#include <zstd.h>
 #include "my_aes.h"
 #include "my_rnd.h"
 #include "mysql/service_mysql_keyring.h"
@@ -1450,6 +1453,24 @@ byte *os_file_compress_page(Compression compression, ulint block_size,
 
       break;
 
+    case Compression::ZSTD: {
+      /* innodb_compression_level is the zlib level, 0..9. It is used
+      as is, 0 selects the Zstandard default level. */
+      const size_t zlen = ZSTD_compress(
+          dst + FIL_PAGE_DATA, out_len, src + FIL_PAGE_DATA, content_len,
+          static_cast<int>(compression_level));
+
+      if (ZSTD_isError(zlen) || zlen >= out_len) {
+        *dst_len = src_len;
+
+        return (src);
+      }
+
+      len = static_cast<ulint>(zlen);
+
+      break;
+    }
+
     default:
       *dst_len = src_len;
       return (src);
@@ -2075,6 +2096,8 @@ static file::Block *os_file_encrypt_log(const IORequest &type, void *&buf,
 
 #ifndef _WIN32
 
+static int os_file_fsync_posix(os_file_t file);
+
 /** Do the read/write
 @param[in]      request The IO context and type
 @return the number of bytes read/written or negative value on error */
@@ -2085,7 +2108,43 @@ ssize_t SyncFileIO::execute(const IORequest &request) {
     n_bytes = pread(m_fh, m_buf, m_n, m_offset);
   } else {
     ut_ad(request.is_write());
+#ifdef RWF_DSYNC
+    int rw_flags = 0;
+
+#ifdef RWF_ATOMIC
+    if (request.is_atomic_write()) {
+      rw_flags |= RWF_ATOMIC;
+    }
+#endif /* RWF_ATOMIC */
+
+    if (request.is_sync_write()) {
+      rw_flags |= RWF_DSYNC;
+    }
+
+    if (rw_flags != 0) {
+      struct iovec iov;
+
+      iov.iov_base = m_buf;
+      iov.iov_len = m_n;
+
+      n_bytes = pwritev2(m_fh, &iov, 1, m_offset, rw_flags);
+
+      if (n_bytes >= 0 || (errno != ENOSYS && errno != EOPNOTSUPP) ||
+          (rw_flags & ~RWF_DSYNC) != 0) {
+        return (n_bytes);
+      }
+
+      /* The kernel does not know RWF_DSYNC, fall back to the explicit
+      flush below. */
+    }
+#endif /* RWF_DSYNC */
+
     n_bytes = pwrite(m_fh, m_buf, m_n, m_offset);
+
+    if (n_bytes > 0 && request.is_sync_write() &&
+        os_file_fsync_posix(m_fh) != 0) {
+      n_bytes = -1;
+    }
   }
 
   return (n_bytes);
@@ -2263,6 +2322,11 @@ dberr_t LinuxAIOHandler::resubmit(Slot *slot) {
     ut_a(slot->type.is_write());
 
     io_prep_pwrite(iocb, slot->file.m_file, slot->ptr, slot->len, slot->offset);
+#ifdef RWF_ATOMIC
+    if (slot->type.is_atomic_write()) {
+      iocb->aio_rw_flags = RWF_ATOMIC;
+    }
+#endif /* RWF_ATOMIC */
   }
   iocb->data = slot;
 
@@ -6164,6 +6228,32 @@ bool os_is_sparse_file_supported(pfs_os_file_t fh) {
   return (err == DB_SUCCESS);
 }
 
+bool os_file_atomic_write_supported(pfs_os_file_t fh, ulint size) {
+#if defined(UNIV_LINUX) && defined(STATX_WRITE_ATOMIC) && defined(RWF_ATOMIC)
+  /* Untorn writes are only guaranteed for direct I/O. */
+  const int flags = fcntl(fh.m_file, F_GETFL);
+
+  if (flags == -1 || (flags & O_DIRECT) == 0) {
+    return (false);
+  }
+
+  struct statx stx;
+
+  if (statx(fh.m_file, "", AT_EMPTY_PATH, STATX_WRITE_ATOMIC, &stx) != 0 ||
+      (stx.stx_mask & STATX_WRITE_ATOMIC) == 0) {
+    return (false);
+  }
+
+  return (stx.stx_atomic_write_segments_max >= 1 &&
+          stx.stx_atomic_write_unit_min <= size &&
+          stx.stx_atomic_write_unit_max >= size);
+#else
+  (void)fh;
+  (void)size;
+  return (false);
+#endif /* UNIV_LINUX && STATX_WRITE_ATOMIC && RWF_ATOMIC */
+}
+
 dberr_t os_get_free_space(const char *path, uint64_t &free_space) {
 #ifdef _WIN32
   uint32_t block_size;
@@ -7121,6 +7211,11 @@ Slot *AIO::reserve_slot(IORequest &type, fil_node_t *m1, void *m2,
     } else {
       ut_ad(type.is_write());
       io_prep_pwrite(iocb, file.m_file, slot->ptr, slot->len, aio_offset);
+#ifdef RWF_ATOMIC
+      if (type.is_atomic_write()) {
+        iocb->aio_rw_flags = RWF_ATOMIC;
+      }
+#endif /* RWF_ATOMIC */
     }
 
     iocb->data = slot;
@@ -34,6 +34,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include "clone0clone.h"
 #include "read0i_s.h"
 
+#include "srv0mon.h"
 #include "srv0srv.h"
 #include "trx0sys.h"
 
@@ -183,6 +184,9 @@ will mark their views as closed but not actually free their views.
 /** Minimum number of elements to reserve in ReadView::ids_t */
 static const ulint MIN_TRX_IDS = 32;
 
+/** Source of ReadView::m_snapshot_id */
+static std::atomic<uint64_t> read_view_snapshot_id{0};
+
 #ifdef UNIV_DEBUG
 /** Functor to validate the view list. */
 struct ViewCheck {
@@ -318,6 +322,8 @@ ReadView::ReadView()
       m_creator_trx_id(),
       m_ids(),
       m_low_limit_no(),
+      m_snapshot_id(),
+      m_ids_version(),
       m_cloned(false) {
   ut_d(::memset(&m_view_list, 0x0, sizeof(m_view_list)));
   ut_d(m_view_low_limit_no = 0);
@@ -468,6 +474,10 @@ void ReadView::prepare(trx_id_t id) {
 
   m_low_limit_id = trx_sys_get_next_trx_id_or_no();
 
+  m_ids_version = trx_sys->rw_trx_ids_version.load();
+
+  m_snapshot_id = ++read_view_snapshot_id;
+
   ut_a(m_low_limit_no <= m_low_limit_id);
 
   if (!trx_sys->rw_trx_ids.empty()) {
@@ -554,18 +564,24 @@ void MVCC::view_open(ReadView *&view, trx_t *trx) {
 
     ut_ad(view->m_closed);
 
-    /* NOTE: This can be optimised further, for now we only
-    reuse the view if there are no active RW transactions.
+    /* The view can be reused if no transaction id or number
+    has been assigned since it was created and the set of active
+    RW transactions has not changed (a rollback or the insertion
+    of a preallocated id changes the set without advancing the
+    counter).
 
     There is an inherent race here between purge and this
     thread. Purge will skip views that are marked as closed.
     Therefore we must set the low limit id after we reset the
     closed status after the check. */
 
-    if (trx_is_autocommit_non_locking(trx) && view->empty()) {
+    if (trx_is_autocommit_non_locking(trx)) {
       view->m_closed = false;
 
-      if (view->m_low_limit_id == trx_sys_get_next_trx_id_or_no()) {
+      if (view->m_low_limit_id == trx_sys_get_next_trx_id_or_no() &&
+          (view->empty() ||
+           view->m_ids_version == trx_sys->rw_trx_ids_version.load())) {
+        MONITOR_INC(MONITOR_TRX_VIEW_REUSED);
         return;
       } else {
         view->m_closed = true;
@@ -653,6 +669,8 @@ void ReadView::copy_prepare(const ReadView &other) {
   m_low_limit_id = other.m_low_limit_id;
 
   m_creator_trx_id = other.m_creator_trx_id;
+
+  m_snapshot_id = ++read_view_snapshot_id;
 }
 
 /**
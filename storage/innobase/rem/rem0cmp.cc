@@ -448,6 +448,36 @@ inline int cmp_data(ulint mtype, ulint prtype, bool is_asc, const byte *data1,
                               data2, (unsigned)len2));
   }
 
+  if (pad == ULINT_UNDEFINED && len1 == len2) {
+    /* INT columns, and other fixed-width binary values of 4 or 8 bytes, are
+    stored big-endian with the sign bit flipped. Compare them as one unsigned
+    word instead of byte by byte. */
+    switch (len1) {
+      case 4: {
+        const auto a = mach_read_from_4(data1);
+        const auto b = mach_read_from_4(data2);
+
+        if (a == b) {
+          return (0);
+        }
+
+        return ((a < b) == is_asc ? -1 : 1);
+      }
+      case 8: {
+        const auto a = mach_read_from_8(data1);
+        const auto b = mach_read_from_8(data2);
+
+        if (a == b) {
+          return (0);
+        }
+
+        return ((a < b) == is_asc ? -1 : 1);
+      }
+      default:
+        break;
+    }
+  }
+
   ulint len;
 
   if (len1 < len2) {
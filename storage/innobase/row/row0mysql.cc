@@ -73,6 +73,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include "row0row.h"
 #include "row0sel.h"
 #include "row0upd.h"
+#include "row0vers.h"
 #include "trx0purge.h"
 #include "trx0rec.h"
 #include "trx0roll.h"
@@ -404,7 +405,7 @@ byte *row_compress_column(const byte *data, ulint *len, ulint lenlen,
     *compress_heap =
         mem_heap_create(std::max(UNIV_PAGE_SIZE, buf_len), UT_LOCATION_HERE);
 
-  buf = static_cast<byte *>(mem_heap_zalloc(*compress_heap, buf_len));
+  buf = static_cast<byte *>(mem_heap_alloc(*compress_heap, buf_len));
 
   if (*len < srv_compressed_columns_threshold ||
       srv_compressed_columns_zip_level == Z_NO_COMPRESSION)
@@ -564,7 +565,7 @@ const byte *row_decompress_column(const byte *data, ulint *len,
   }
 
   buf_len = uncomp_len;
-  buf = static_cast<byte *>(mem_heap_zalloc(*compress_heap, buf_len));
+  buf = static_cast<byte *>(mem_heap_alloc(*compress_heap, buf_len));
 
   /* init d_stream */
   d_stream.next_in = const_cast<Bytef *>(data);
@@ -1435,6 +1436,8 @@ void row_prebuilt_free(row_prebuilt_t *prebuilt, bool dict_locked) {
     mem_heap_free(prebuilt->old_vers_heap);
   }
 
+  ut::delete_(prebuilt->vers_cache);
+
   if (prebuilt->fetch_cache[0] != nullptr) {
     byte *base = prebuilt->fetch_cache[0] - 4;
     byte *ptr = base;
@@ -5249,8 +5252,19 @@ bool row_prebuilt_t::can_prefetch_records() const {
   cannot cache rows in the case there are BLOBs in the fields to
   be fetched. In HANDLER (note: the HANDLER statement, not the
   handler class) we do not cache rows because there the cursor
-  is a scrollable cursor. */
-  return select_lock_type == LOCK_NONE && !m_no_prefetch &&
+  is a scrollable cursor.
+
+  A plain SELECT ... FOR SHARE/UPDATE may prefetch too: the cursor
+  position is not used for an update, and with the locks on the
+  non-matching rows kept, unlock_row() does not depend on it either.
+  Every prefetched row is locked before it is cached. */
+  const bool lock_allows_prefetch =
+      select_lock_type == LOCK_NONE ||
+      (srv_prefetch_locking_reads && select_mode == SELECT_ORDINARY &&
+       trx->mysql_thd != nullptr && thd_is_query_block(trx->mysql_thd) &&
+       !trx->releases_non_matching_rows());
+
+  return lock_allows_prefetch && !m_no_prefetch &&
          !templ_contains_blob && !templ_contains_fixed_point &&
          !clust_index_was_generated && !used_in_HANDLER && !innodb_api &&
          template_type != ROW_MYSQL_DUMMY_TEMPLATE && !in_fts_query;
@@ -3072,9 +3072,20 @@ bool row_sel_store_mysql_rec(byte *mysql_rec, row_prebuilt_t *prebuilt,
     prebuilt->old_vers_heap = mem_heap_create(200, UT_LOCATION_HERE);
   }
 
+  Row_vers_cache *cache = nullptr;
+
+  if (srv_cons_read_vers_cache_size > 0) {
+    if (prebuilt->vers_cache == nullptr) {
+      prebuilt->vers_cache =
+          ut::new_withkey<Row_vers_cache>(UT_NEW_THIS_FILE_PSI_KEY);
+    }
+
+    cache = prebuilt->vers_cache;
+  }
+
   err = row_vers_build_for_consistent_read(
       rec, mtr, clust_index, offsets, read_view, offset_heap,
-      prebuilt->old_vers_heap, old_vers, vrow, lob_undo);
+      prebuilt->old_vers_heap, old_vers, vrow, lob_undo, cache);
 
   return err;
 }
@@ -4460,6 +4471,34 @@ static bool use_secondary_index(const row_prebuilt_t *prebuilt,
   return true;
 }
 
+bool row_search_pop_prefetched(byte *buf, row_prebuilt_t *prebuilt,
+                               ulint direction) {
+  if (prebuilt->n_fetch_cached == 0 || prebuilt->n_rows_fetched == 0 ||
+      direction != prebuilt->fetch_direction) {
+    return false;
+  }
+
+  ut_ad(prebuilt->magic_n == ROW_PREBUILT_ALLOCATED);
+  ut_ad(!prebuilt->trx->has_search_latch);
+
+  prebuilt->new_rec_lock.reset();
+
+  row_sel_dequeue_cached_row_for_mysql(buf, prebuilt);
+
+  prebuilt->n_rows_fetched++;
+
+  /* As on the cache path of row_search_mvcc(), the returned row was not
+  fetched with a semi-consistent read, whether the batch was prefetched by a
+  consistent or by a locking read; see func_exit of row_search_mvcc(). */
+  if (prebuilt->row_read_type != ROW_READ_WITH_LOCKS) {
+    prebuilt->row_read_type = ROW_READ_TRY_SEMI_CONSISTENT;
+  }
+
+  prebuilt->lob_undo_reset();
+
+  return true;
+}
+
 /** Searches for rows in the database using cursor.
 Function is mainly used for tables that are shared accorss connection and
 so it employs technique that can help re-construct the rows that
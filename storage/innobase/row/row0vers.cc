@@ -47,6 +47,8 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include "row0row.h"
 #include "row0upd.h"
 #include "row0vers.h"
+#include "srv0mon.h"
+#include "srv0srv.h"
 #include "trx0purge.h"
 #include "trx0rec.h"
 #include "trx0roll.h"
@@ -1229,6 +1231,123 @@ bool row_vers_old_has_index_entry(
   }
 }
 
+Row_vers_cache::Key::Key(const dict_index_t *index, const rec_t *rec,
+                         const ulint *offsets)
+    : m_index_id(index->id),
+      m_trx_id(row_get_rec_trx_id(rec, index, offsets)),
+      m_roll_ptr(row_get_rec_roll_ptr(rec, index, offsets)) {}
+
+size_t Row_vers_cache::Key_hash::operator()(const Key &key) const {
+  return static_cast<size_t>(ut::hash_uint64_pair(
+      ut::hash_uint64_pair(key.m_index_id, key.m_trx_id), key.m_roll_ptr));
+}
+
+void Row_vers_cache::clear() {
+  for (auto &elem : m_map) {
+    ut::free(elem.second.m_buf);
+  }
+
+  m_map.clear();
+  m_fifo.clear();
+  m_size = 0;
+}
+
+void Row_vers_cache::reset_if_needed(const ReadView *view) {
+  if (view->snapshot_id() != m_snapshot_id) {
+    clear();
+    m_snapshot_id = view->snapshot_id();
+  }
+}
+
+rec_t *Row_vers_cache::lookup(const ReadView *view, const Key &key,
+                              dict_index_t *index, const rec_t *rec,
+                              const ulint *offsets, mem_heap_t *in_heap,
+                              ulint **vers_offsets, mem_heap_t **offset_heap) {
+  reset_if_needed(view);
+
+  const auto it = m_map.find(key);
+
+  if (it == m_map.end()) {
+    MONITOR_INC(MONITOR_VERS_CACHE_MISS);
+    return nullptr;
+  }
+
+  const Entry &entry = it->second;
+
+  auto buf = static_cast<byte *>(mem_heap_alloc(in_heap, entry.m_size));
+
+  memcpy(buf, entry.m_buf, entry.m_size);
+
+  rec_t *vers = buf + entry.m_extra_size;
+
+  ulint *new_offsets = rec_get_offsets(vers, index, nullptr, ULINT_UNDEFINED,
+                                       UT_LOCATION_HERE, offset_heap);
+
+  /* Undo log space freed by a rollback to savepoint can be reused,
+  so the same DB_ROLL_PTR could later point to the undo of another row
+  of the same transaction. The primary key, which an update never
+  changes in place, tells the two apart. */
+  for (ulint i = 0; i < dict_index_get_n_unique(index); ++i) {
+    ulint len;
+    ulint vers_len;
+    const byte *field = rec_get_nth_field(index, rec, offsets, i, &len);
+    const byte *vers_field =
+        rec_get_nth_field(index, vers, new_offsets, i, &vers_len);
+
+    if (len != vers_len || (len != UNIV_SQL_NULL && len > 0 &&
+                            memcmp(field, vers_field, len) != 0)) {
+      MONITOR_INC(MONITOR_VERS_CACHE_MISS);
+      return nullptr;
+    }
+  }
+
+  MONITOR_INC(MONITOR_VERS_CACHE_HIT);
+
+  *vers_offsets = new_offsets;
+
+  return vers;
+}
+
+void Row_vers_cache::insert(const ReadView *view, const Key &key,
+                            const rec_t *vers, const ulint *vers_offsets) {
+  const ulint max_size = srv_cons_read_vers_cache_size;
+  const ulint size = rec_offs_size(vers_offsets);
+
+  /* Do not let a single large record flush the whole cache. */
+  if (size > max_size / 4) {
+    return;
+  }
+
+  reset_if_needed(view);
+
+  if (m_map.find(key) != m_map.end()) {
+    return;
+  }
+
+  while (m_size + size > max_size && !m_fifo.empty()) {
+    const auto it = m_map.find(m_fifo.front());
+
+    ut_ad(it != m_map.end());
+    m_size -= it->second.m_size;
+    ut::free(it->second.m_buf);
+    m_map.erase(it);
+    m_fifo.pop_front();
+  }
+
+  auto buf = static_cast<byte *>(
+      ut::malloc_withkey(ut::make_psi_memory_key(mem_key_row_vers_cache), size));
+
+  if (buf == nullptr) {
+    return;
+  }
+
+  rec_copy(buf, vers, vers_offsets);
+
+  m_map.emplace(key, Entry{buf, rec_offs_extra_size(vers_offsets), size});
+  m_fifo.push_back(key);
+  m_size += size;
+}
+
 /** Constructs the version of a clustered index record which a consistent
  read should see. We assume that the trx id stored in rec is such that
  the consistent read should not see rec in its present version.
@@ -1250,11 +1369,14 @@ bool row_vers_old_has_index_entry(
                           was freshly inserted afterwards.
  @param[out]   vrow   reports virtual column info if any
  @param[in]   lob_undo   undo log to be applied to blobs.
+ @param[in,out]   cache   cache of versions already built for the view, or
+                          nullptr
  @return DB_SUCCESS or DB_MISSING_HISTORY */
 dberr_t row_vers_build_for_consistent_read(
     const rec_t *rec, mtr_t *mtr, dict_index_t *index, ulint **offsets,
     ReadView *view, mem_heap_t **offset_heap, mem_heap_t *in_heap,
-    rec_t **old_vers, const dtuple_t **vrow, lob::undo_vers_t *lob_undo) {
+    rec_t **old_vers, const dtuple_t **vrow, lob::undo_vers_t *lob_undo,
+    Row_vers_cache *cache) {
   DBUG_TRACE;
   const rec_t *version;
   rec_t *prev_version;
@@ -1281,6 +1403,25 @@ dberr_t row_vers_build_for_consistent_read(
 
   ut_ad(!vrow || !(*vrow));
 
+  /* Versions that carry virtual column or LOB undo information for the
+  caller are not cached. */
+  if (vrow != nullptr && index->table->n_v_cols > 0) {
+    cache = nullptr;
+  }
+
+  Row_vers_cache::Key key;
+
+  if (cache != nullptr) {
+    key = Row_vers_cache::Key(index, rec, *offsets);
+
+    *old_vers = cache->lookup(view, key, index, rec, *offsets, in_heap,
+                              offsets, offset_heap);
+
+    if (*old_vers != nullptr) {
+      return DB_SUCCESS;
+    }
+  }
+
   version = rec;
 
   for (;;) {
@@ -1335,6 +1476,11 @@ dberr_t row_vers_build_for_consistent_read(
         *vrow = dtuple_copy(*vrow, in_heap);
         dtuple_dup_v_fld(*vrow, in_heap);
       }
+
+      if (cache != nullptr && err == DB_SUCCESS &&
+          (lob_undo == nullptr || lob_undo->empty())) {
+        cache->insert(view, key, *old_vers, *offsets);
+      }
       break;
     }
 
@@ -185,6 +185,14 @@ static dberr_t srv_conc_enter_innodb_with_atomics(
       srv_thread_sleep_delay = static_cast<ulong>(sleep_in_us);
     }
 
+    /* A transaction that already holds row locks keeps every transaction
+    waiting for those locks blocked for as long as it sleeps here. Let it
+    poll for a free slot more often, so that it tends to enter first and
+    the lock convoy behind it drains. */
+    if (trx->lock.n_rec_locks.load(std::memory_order_relaxed) > 0) {
+      sleep_in_us /= 4;
+    }
+
     std::this_thread::sleep_for(std::chrono::microseconds(sleep_in_us));
     trx->stats.bump_innodb_enter_wait(*trx, sleep_in_us);
 
@@ -132,6 +132,31 @@ static monitor_info_t innodb_counter_info[] = {
      "Number of times a wait-for graph was scanned in search for deadlocks",
      MONITOR_DEFAULT_ON, MONITOR_DEFAULT_START, MONITOR_DEADLOCK_ROUNDS},
 
+    {"lock_deadlock_edge_walks", "lock",
+     "Number of times a new or changed wait-for edge was followed to check "
+     "if it closes a cycle (innodb_deadlock_detect_incremental)",
+     MONITOR_NONE, MONITOR_DEFAULT_START, MONITOR_DEADLOCK_EDGE_WALKS},
+
+    {"lock_deadlock_edge_walk_steps", "lock",
+     "Number of wait-for edges followed by the incremental cycle checks",
+     MONITOR_NONE, MONITOR_DEFAULT_START, MONITOR_DEADLOCK_EDGE_WALK_STEPS},
+
+    {"lock_deadlock_cycle_length", "lock",
+     "Number of transactions on the last candidate deadlock cycle found",
+     static_cast<monitor_type_t>(MONITOR_DISPLAY_CURRENT), MONITOR_DEFAULT_START,
+     MONITOR_DEADLOCK_CYCLE_LENGTH},
+
+    {"lock_deadlock_pass_time", "lock",
+     "Time in microseconds of the last scan of the wait-for graph",
+     static_cast<monitor_type_t>(MONITOR_DISPLAY_CURRENT), MONITOR_DEFAULT_START,
+     MONITOR_DEADLOCK_PASS_TIME},
+
+    {"lock_rec_batched_edges", "lock",
+     "Number of wait-for edges of record lock waiters which were redirected "
+     "together, with a single notification, when a lock on a hot row was "
+     "released",
+     MONITOR_NONE, MONITOR_DEFAULT_START, MONITOR_LOCK_REC_BATCHED_EDGES},
+
     {"lock_threads_waiting", "lock",
      "Number of query threads sleeping waiting for a lock",
      static_cast<monitor_type_t>(MONITOR_DEFAULT_ON | MONITOR_DISPLAY_CURRENT),
@@ -446,6 +471,14 @@ static monitor_info_t innodb_counter_info[] = {
      "Total sleep waits in LRU get free.", MONITOR_NONE, MONITOR_DEFAULT_START,
      MONITOR_LRU_GET_FREE_WAITS},
 
+    {"buffer_LRU_manager_free_pages", "buffer",
+     "Total pages flushed or evicted by the LRU manager threads",
+     MONITOR_NONE, MONITOR_DEFAULT_START, MONITOR_LRU_MANAGER_FREE_PAGES},
+
+    {"buffer_LRU_manager_free_page_rate", "buffer",
+     "Pages per second flushed or evicted by the LRU manager threads",
+     MONITOR_NONE, MONITOR_DEFAULT_START, MONITOR_LRU_MANAGER_FREE_PAGE_RATE},
+
     {"buffer_flush_avg_page_rate", "buffer",
      "Average number of pages at which flushing is happening", MONITOR_NONE,
      MONITOR_DEFAULT_START, MONITOR_FLUSH_AVG_PAGE_RATE},
@@ -797,6 +830,18 @@ static monitor_info_t innodb_counter_info[] = {
     {"trx_allocations", "transaction", "Number of trx_t allocations",
      MONITOR_NONE, MONITOR_DEFAULT_START, MONITOR_TRX_ALLOCATIONS},
 
+    {"trx_read_views_reused", "transaction",
+     "Number of read views reopened without acquiring trx_sys->mutex",
+     MONITOR_NONE, MONITOR_DEFAULT_START, MONITOR_TRX_VIEW_REUSED},
+
+    {"trx_version_cache_hits", "transaction",
+     "Number of old record versions found in the consistent read cache",
+     MONITOR_NONE, MONITOR_DEFAULT_START, MONITOR_VERS_CACHE_HIT},
+
+    {"trx_version_cache_misses", "transaction",
+     "Number of old record versions not found in the consistent read cache",
+     MONITOR_NONE, MONITOR_DEFAULT_START, MONITOR_VERS_CACHE_MISS},
+
     MONITOR_WAIT_STATS("trx_on_log_", "transaction",
                        "Waits for redo during transaction commits",
                        MONITOR_TRX_ON_LOG_),
@@ -837,6 +882,10 @@ static monitor_info_t innodb_counter_info[] = {
      "Number of undo log pages handled by the purge", MONITOR_NONE,
      MONITOR_DEFAULT_START, MONITOR_PURGE_N_PAGE_HANDLED},
 
+    {"purge_undo_pages_prefetched", "purge",
+     "Number of undo log pages read ahead by the purge", MONITOR_NONE,
+     MONITOR_DEFAULT_START, MONITOR_PURGE_UNDO_PREFETCH},
+
     {"purge_dml_delay_usec", "purge",
      "Microseconds DML to be delayed due to purge lagging",
      MONITOR_DISPLAY_CURRENT, MONITOR_DEFAULT_START, MONITOR_DML_PURGE_DELAY},
@@ -1099,6 +1148,10 @@ static monitor_info_t innodb_counter_info[] = {
     {"index_page_discards", "index", "Number of index pages discarded",
      MONITOR_NONE, MONITOR_DEFAULT_START, MONITOR_INDEX_DISCARD},
 
+    {"index_mrr_pages_prefetched", "index",
+     "Number of clustered index pages read ahead for Multi-Range Read",
+     MONITOR_NONE, MONITOR_DEFAULT_START, MONITOR_MRR_PAGES_PREFETCHED},
+
     /* ========== Counters for Adaptive Hash Index ========== */
     {"module_adaptive_hash", "adaptive_hash_index", "Adaptive Hash Index",
      MONITOR_MODULE, MONITOR_DEFAULT_START, MONITOR_MODULE_ADAPTIVE_HASH},
@@ -1192,6 +1245,10 @@ static monitor_info_t innodb_counter_info[] = {
      static_cast<monitor_type_t>(MONITOR_EXISTING | MONITOR_DEFAULT_ON),
      MONITOR_DEFAULT_START, MONITOR_OVLD_IBUF_SIZE},
 
+    {"ibuf_sweep_merge_pages", "change_buffer",
+     "Number of pages read by the key-ordered background merge sweep",
+     MONITOR_NONE, MONITOR_DEFAULT_START, MONITOR_IBUF_SWEEP_MERGE_PAGES},
+
     /* ========== Counters for server operations ========== */
     {"module_innodb", "innodb",
      "Counter for general InnoDB server wide operations and properties",
@@ -197,6 +197,13 @@ unsigned long long srv_max_undo_tablespace_size;
 /** Enable or disable encryption of temporary tablespace.*/
 bool srv_tmp_tablespace_encrypt;
 
+/** Whether to count sampled buffer pool page accesses per index. */
+bool srv_sample_index_accesses = false;
+
+/** Size in megabytes by which session temporary tablespaces are extended,
+or 0 to extend them like file-per-table tablespaces. */
+ulong srv_session_temp_extend_increment = 0;
+
 /** Option to enable encryption of system tablespace. */
 bool srv_sys_tablespace_encrypt;
 
@@ -231,6 +238,7 @@ use simulated aio we build below with threads. */
 bool srv_use_native_aio = false;
 
 bool srv_numa_interleave = false;
+bool srv_numa_node_affinity = false;
 
 #ifdef UNIV_DEBUG
 /** Force all user tables to use page compression. */
@@ -269,6 +277,10 @@ ulong srv_log_buffer_size;
 /** Size of block, used for writing ahead to avoid read-on-write. */
 ulong srv_log_write_ahead_size;
 
+/** Whether the log writer makes each redo write durable itself (a write
+linked with fdatasync), when innodb_flush_log_at_trx_commit = 1. */
+bool srv_log_writer_sync_write = false;
+
 /** Whether to activate/pause the log writer threads. */
 bool srv_log_writer_threads;
 
@@ -463,6 +475,7 @@ bool srv_validate_tablespace_paths = true;
 bool srv_use_fdatasync = false;
 /** Scan depth for LRU flush batch i.e.: number of blocks scanned*/
 ulong srv_LRU_scan_depth = 1024;
+ulong srv_LRU_ghost_list_size = 0;
 /** Whether or not to flush neighbors of a block */
 ulong srv_flush_neighbors = 1;
 /** Previously requested size. Accesses protected by memory barriers. */
@@ -571,6 +584,14 @@ ulong srv_n_purge_threads = 4;
 /* the number of pages to purge in one batch */
 ulong srv_purge_batch_size = 20;
 
+bool srv_purge_undo_prefetch = false;
+
+ulong srv_cons_read_vers_cache_size = 0;
+
+bool srv_prefetch_locking_reads = false;
+
+bool srv_mrr_prefetch = false;
+
 enum_default_table_encryption srv_default_table_encryption;
 
 ulong srv_encrypt_tables = 0;
@@ -600,6 +621,10 @@ This is for testing and debugging only. */
 ulong srv_force_recovery_crash;
 #endif /* UNIV_DEBUG */
 
+/** Number of threads applying redo records to pages in a recovery batch.
+Each thread takes a disjoint range of the pages of the batch. */
+ulong srv_recv_apply_threads = 1;
+
 /** Print all user-level transactions deadlocks to mysqld stderr */
 bool srv_print_all_deadlocks = false;
 
@@ -643,6 +668,7 @@ bool srv_stats_persistent = true;
 bool srv_stats_include_delete_marked = false;
 unsigned long long srv_stats_persistent_sample_pages = 20;
 bool srv_stats_auto_recalc = true;
+ulong srv_stats_auto_recalc_pages_per_sec = 0;
 
 ulong srv_replication_delay = 0;
 std::chrono::milliseconds get_srv_replication_delay() {
@@ -870,6 +896,8 @@ and/or load it during startup. */
 bool srv_buffer_pool_dump_at_shutdown = true;
 bool srv_buffer_pool_load_at_startup = true;
 
+ulong srv_buf_load_threads = 1;
+
 /** Slot index in the srv_sys->sys_threads array for the purge thread. */
 static const ulint SRV_PURGE_SLOT = 1;
 
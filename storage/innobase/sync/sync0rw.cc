@@ -170,6 +170,36 @@ wait_ex_event:  A thread may only wait on the wait_ex_event after it has
 rw_lock_list_t rw_lock_list{};
 ib_mutex_t rw_lock_list_mutex;
 
+/** Number of spin rounds still granted to a rw-lock whose recent waits all
+ended up suspended in the sync array */
+static constexpr ulint RW_LOCK_MIN_SPIN_ROUNDS = 4;
+
+/** Get the number of spin rounds to try on a rw-lock before suspending the
+thread: twice the recent average, capped by innodb_spin_wait_rounds.
+Locks which are held for long stop burning CPU in spin loops, while locks
+with short hold times keep spinning.
+@param[in]      lock    rw-lock to wait for
+@return spin round budget */
+static inline ulint rw_lock_spin_budget(const rw_lock_t *lock) {
+  const ulint avg = lock->spin_rounds.load(std::memory_order_relaxed) >> 4;
+
+  return std::min<ulint>(srv_n_spin_wait_rounds,
+                         2 * avg + RW_LOCK_MIN_SPIN_ROUNDS);
+}
+
+/** Update the spin round average of a rw-lock after a wait.
+@param[in,out]  lock    rw-lock that was waited for
+@param[in]      rounds  spin rounds after which the lock was granted, or 0
+                        if the thread had to be suspended */
+static inline void rw_lock_spin_learn(rw_lock_t *lock, ulint rounds) {
+  constexpr lint max = std::numeric_limits<uint16_t>::max();
+  const lint avg = lock->spin_rounds.load(std::memory_order_relaxed);
+  const lint sample = std::min<lint>(static_cast<lint>(rounds) << 4, max);
+
+  lock->spin_rounds.store(static_cast<uint16_t>(avg + (sample - avg) / 8),
+                          std::memory_order_relaxed);
+}
+
 #ifdef UNIV_DEBUG
 /** Creates a debug info struct. */
 static rw_lock_debug_t *rw_lock_debug_create(void);
@@ -226,6 +256,12 @@ void rw_lock_create_func(rw_lock_t *lock,
   lock->last_x_file_name = "not yet reserved";
   lock->last_s_line = 0;
   lock->last_x_line = 0;
+  /* Start with the full innodb_spin_wait_rounds budget */
+  lock->spin_rounds.store(
+      static_cast<uint16_t>(std::min<ulint>(
+          (srv_n_spin_wait_rounds / 2) << 4,
+          std::numeric_limits<uint16_t>::max())),
+      std::memory_order_relaxed);
   lock->event = os_event_create();
   lock->wait_ex_event = os_event_create();
 
@@ -273,6 +309,7 @@ void rw_lock_s_lock_spin(rw_lock_t *lock, ulint pass, ut::Location location) {
   ulint i = 0; /* spin round count */
   sync_array_t *sync_arr;
   uint64_t count_os_wait = 0;
+  const ulint spin_budget = rw_lock_spin_budget(lock);
 
   /* We reuse the thread id to index into the counter, cache
   it here for efficiency. */
@@ -283,7 +320,7 @@ lock_loop:
 
   /* Spin waiting for the writer field to become free */
   os_rmb;
-  while (i < srv_n_spin_wait_rounds && lock->lock_word <= 0) {
+  while (i < spin_budget && lock->lock_word <= 0) {
     if (srv_spin_wait_delay) {
       ut_delay(ut::random_from_interval(0, srv_spin_wait_delay));
     }
@@ -291,7 +328,7 @@ lock_loop:
     i++;
   }
 
-  if (i >= srv_n_spin_wait_rounds) {
+  if (i >= spin_budget) {
     std::this_thread::yield();
   }
 
@@ -299,14 +336,20 @@ lock_loop:
   if (rw_lock_s_lock_low(lock, pass, location)) {
     if (count_os_wait > 0) {
       lock->count_os_wait += static_cast<uint32_t>(count_os_wait);
+    } else if (i > 0) {
+      rw_lock_spin_learn(lock, i);
     }
 
     return; /* Success */
   } else {
-    if (i < srv_n_spin_wait_rounds) {
+    if (i < spin_budget) {
       goto lock_loop;
     }
 
+    if (count_os_wait == 0) {
+      rw_lock_spin_learn(lock, 0);
+    }
+
     ++count_os_wait;
 
     sync_cell_t *cell;
@@ -573,6 +616,7 @@ void rw_lock_x_lock_func(rw_lock_t *lock, ulint pass, ut::Location location) {
   ulint i = 0;
   sync_array_t *sync_arr;
   uint64_t count_os_wait = 0;
+  const ulint spin_budget = rw_lock_spin_budget(lock);
   bool spinning = false;
 
   ut_ad(rw_lock_validate(lock));
@@ -583,6 +627,8 @@ lock_loop:
   if (rw_lock_x_lock_low(lock, pass, location.filename, location.line)) {
     if (count_os_wait > 0) {
       lock->count_os_wait += static_cast<uint32_t>(count_os_wait);
+    } else if (i > 0) {
+      rw_lock_spin_learn(lock, i);
     }
 
     /* Locking succeeded */
@@ -595,7 +641,7 @@ lock_loop:
 
     /* Spin waiting for the lock_word to become free */
     os_rmb;
-    while (i < srv_n_spin_wait_rounds && lock->lock_word <= X_LOCK_HALF_DECR) {
+    while (i < spin_budget && lock->lock_word <= X_LOCK_HALF_DECR) {
       if (srv_spin_wait_delay) {
         ut_delay(ut::random_from_interval(0, srv_spin_wait_delay));
       }
@@ -603,7 +649,7 @@ lock_loop:
       i++;
     }
 
-    if (i >= srv_n_spin_wait_rounds) {
+    if (i >= spin_budget) {
       std::this_thread::yield();
 
     } else {
@@ -630,6 +676,10 @@ lock_loop:
     return;
   }
 
+  if (count_os_wait == 0) {
+    rw_lock_spin_learn(lock, 0);
+  }
+
   ++count_os_wait;
 
   sync_array_wait_event(sync_arr, cell);
@@ -643,6 +693,7 @@ void rw_lock_sx_lock_func(rw_lock_t *lock, ulint pass, ut::Location location) {
   ulint i = 0;
   sync_array_t *sync_arr;
   uint64_t count_os_wait = 0;
+  const ulint spin_budget = rw_lock_spin_budget(lock);
 
   ut_ad(rw_lock_validate(lock));
   ut_ad(!rw_lock_own(lock, RW_LOCK_S));
@@ -652,6 +703,8 @@ lock_loop:
   if (rw_lock_sx_lock_low(lock, pass, location)) {
     if (count_os_wait > 0) {
       lock->count_os_wait += static_cast<uint32_t>(count_os_wait);
+    } else if (i > 0) {
+      rw_lock_spin_learn(lock, i);
     }
 
     /* Locking succeeded */
@@ -660,7 +713,7 @@ lock_loop:
   } else {
     /* Spin waiting for the lock_word to become free */
     os_rmb;
-    while (i < srv_n_spin_wait_rounds && lock->lock_word <= X_LOCK_HALF_DECR) {
+    while (i < spin_budget && lock->lock_word <= X_LOCK_HALF_DECR) {
       if (srv_spin_wait_delay) {
         ut_delay(ut::random_from_interval(0, srv_spin_wait_delay));
       }
@@ -668,7 +721,7 @@ lock_loop:
       i++;
     }
 
-    if (i >= srv_n_spin_wait_rounds) {
+    if (i >= spin_budget) {
       std::this_thread::yield();
 
     } else {
@@ -695,6 +748,10 @@ lock_loop:
     return;
   }
 
+  if (count_os_wait == 0) {
+    rw_lock_spin_learn(lock, 0);
+  }
+
   ++count_os_wait;
 
   sync_array_wait_event(sync_arr, cell);
@@ -36,6 +36,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 
 #include <current_thd.h>
 #include <sql_class.h>
+#include "buf0rea.h"
 #include "clone0api.h"
 #include "clone0clone.h"
 #include "dict0dd.h"
@@ -1216,8 +1217,7 @@ if any qualify to be truncated.
                     If none exist, check if conditions allow implicit
                        truncation.
                     If conditions allow, choose an implicitly inactive space.
-                    If none exist and no space has been truncated yet,
-                       look for an undo space that is too big.
+                    If none exist, look for an undo space that is too big.
   Fast shutdown;    Do not truncate.  This routine is not called.
   Slow shutdown;    Choose the marked space.
                     If none are marked, choose an explicitly inactive
@@ -1283,16 +1283,18 @@ static bool trx_purge_mark_undo_for_truncate(size_t truncate_count) {
       return (false);
     }
 
-    /* Skip truncate if the caller has already truncated an undo space. */
-    if (truncate_count > 0) {
-      return (false);
-    }
-
-    /* Wait at least one second between searches. */
-    if (undo_trunc->check_timer() < PURGE_CHECK_UNDO_TRUNCATE_DELAY_IN_MS) {
-      return (false);
+    /* Wait at least one second between searches. Once the caller has
+    truncated an undo space, go on right away with the next one that is
+    too big, so that oversized undo spaces that are already empty after a
+    long transaction are all shrunk in this round instead of one per round.
+    The loop in the caller stops at the first marked space that still
+    holds undo logs. */
+    if (truncate_count == 0) {
+      if (undo_trunc->check_timer() < PURGE_CHECK_UNDO_TRUNCATE_DELAY_IN_MS) {
+        return (false);
+      }
+      undo_trunc->reset_timer();
     }
-    undo_trunc->reset_timer();
   }
 
   /* Find an undo tablespace that is too big and needs to be truncated. */
@@ -1727,6 +1729,28 @@ static void trx_purge_truncate_undo_spaces() {
   }
 }
 
+/** Issue an asynchronous read of an undo page that purge is about to need,
+unless it is already in the buffer pool.
+@param[in]      space_id        undo tablespace id
+@param[in]      page_no         undo page number, or FIL_NULL
+@param[in]      page_size       page size of the undo tablespace */
+static void trx_purge_prefetch_undo_page(space_id_t space_id, page_no_t page_no,
+                                         const page_size_t &page_size) {
+  if (!srv_purge_undo_prefetch || page_no == FIL_NULL) {
+    return;
+  }
+
+  const page_id_t page_id(space_id, page_no);
+
+  if (buf_page_peek(page_id)) {
+    return;
+  }
+
+  if (buf_read_page_background(page_id, page_size, false)) {
+    MONITOR_INC(MONITOR_PURGE_UNDO_PREFETCH);
+  }
+}
+
 /** Updates the last not yet purged history log info in rseg when we have purged
  a whole undo log. Advances also purge_sys->purge_trx_no past the purged log. */
 static void trx_purge_rseg_get_next_history_log(
@@ -1808,8 +1832,15 @@ static void trx_purge_rseg_get_next_history_log(
 
   auto del_marks = mach_read_from_2(log_hdr + TRX_UNDO_DEL_MARKS);
 
+  /* The log after this one in purge order is read by a later call. */
+  const auto next_log_addr = trx_purge_get_log_from_hist(
+      flst_get_prev_addr(log_hdr + TRX_UNDO_HISTORY_NODE, &mtr));
+
   mtr_commit(&mtr);
 
+  trx_purge_prefetch_undo_page(rseg->space_id, next_log_addr.page,
+                               rseg->page_size);
+
   rseg->latch();
 
   rseg->last_page_no = prev_log_addr.page;
@@ -1947,6 +1978,14 @@ static trx_undo_rec_t *trx_purge_get_next_rec(
   undo_page =
       trx_undo_page_get_s_latched(page_id_t(space, page_no), page_size, &mtr);
 
+  /* The undo records of a log continue on the next page of the log. */
+  trx_purge_prefetch_undo_page(
+      space,
+      flst_get_next_addr(undo_page + TRX_UNDO_PAGE_HDR + TRX_UNDO_PAGE_NODE,
+                         &mtr)
+          .page,
+      page_size);
+
   rec = undo_page + offset;
 
   rec2 = rec;
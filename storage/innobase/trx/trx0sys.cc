@@ -612,6 +612,8 @@ void trx_sys_create(void) {
   new (&trx_sys->rw_trx_ids)
       trx_ids_t(ut::allocator<trx_id_t>(mem_key_trx_sys_t_rw_trx_ids));
 
+  trx_sys->rw_trx_ids_version.store(0);
+
   for (auto &shard : trx_sys->shards) {
     new (&shard) Trx_shard{};
   }
@@ -465,6 +465,8 @@ static trx_t *trx_create_low() {
 
   trx->purge_sys_trx = false;
 
+  trx->rseg_slot_hint = ULINT_UNDEFINED;
+
   /* Background trx should not be forced to rollback,
   we will unset the flag for user trx. */
   trx->in_innodb |= TRX_FORCE_ROLLBACK_DISABLE;
@@ -1121,6 +1123,7 @@ void trx_lists_init_at_db_start(void) {
     if (trx->state.load(std::memory_order_relaxed) == TRX_STATE_ACTIVE ||
         trx->state.load(std::memory_order_relaxed) == TRX_STATE_PREPARED) {
       trx_sys->rw_trx_ids.push_back(trx->id);
+      trx_sys->rw_trx_ids_version.fetch_add(1);
     }
     trx_add_to_rw_trx_list(trx);
   }
@@ -1134,8 +1137,9 @@ If an rseg is not marked for undo tablespace truncation, we assign
 it to a transaction. We increment trx_ref_count to keep the purge
 thread from truncating the undo tablespace that contains this rseg
 until the transaction is done with it.
+@param[in,out]  trx     transaction; its rseg_slot_hint is tried first
 @return assigned rollback segment instance */
-static trx_rseg_t *get_next_redo_rseg_from_undo_spaces() {
+static trx_rseg_t *get_next_redo_rseg_from_undo_spaces(trx_t *trx) {
   undo::Tablespace *undo_space;
 
   /* The number of undo tablespaces cannot be changed while
@@ -1155,7 +1159,21 @@ static trx_rseg_t *get_next_redo_rseg_from_undo_spaces() {
 
   static std::atomic<ulint> rseg_counter{0};
   trx_rseg_t *rseg = nullptr;
-  ulint current = rseg_counter;
+  const ulint n_windows = target_rollback_segments * target_undo_tablespaces;
+
+  /* Try the rseg of the previous transaction first. Only fall back to
+  the shared round-robin counter when it is no longer usable. */
+  if (trx->rseg_slot_hint < n_windows) {
+    undo_space =
+        undo::spaces->at(trx->rseg_slot_hint % target_undo_tablespaces);
+
+    if (undo_space->is_active_no_latch()) {
+      rseg = undo_space->get_active(trx->rseg_slot_hint /
+                                    target_undo_tablespaces);
+    }
+  }
+
+  ulint current = rseg == nullptr ? rseg_counter.load() : 0;
 
   while (rseg == nullptr) {
     /* Increment the static redo_rseg_slot so the next call from any thread
@@ -1164,8 +1182,7 @@ static trx_rseg_t *get_next_redo_rseg_from_undo_spaces() {
 
     /* Traverse the rsegs like this: (space, rseg_id)
     (0,0), (1,0), ... (n,0), (0,1), (1,1), ... (n,1), ... */
-    ulint window =
-        current % (target_rollback_segments * target_undo_tablespaces);
+    ulint window = current % n_windows;
     ulint spaces_slot = window % target_undo_tablespaces;
     ulint rseg_slot = window / target_undo_tablespaces;
 
@@ -1191,6 +1208,8 @@ static trx_rseg_t *get_next_redo_rseg_from_undo_spaces() {
     if (rseg == nullptr) {
       continue;
     }
+
+    trx->rseg_slot_hint = window;
   }
 
   undo::spaces->s_unlock();
@@ -1202,8 +1221,9 @@ static trx_rseg_t *get_next_redo_rseg_from_undo_spaces() {
 
 /** Get the next redo rollback segment in round-robin fashion.
 The assigned slots may have gaps but the vector does not.
+@param[in,out]  trx     transaction; its rseg_slot_hint is tried first
 @return assigned rollback segment instance */
-static trx_rseg_t *get_next_redo_rseg_from_trx_sys() {
+static trx_rseg_t *get_next_redo_rseg_from_trx_sys(trx_t *trx) {
   static std::atomic<ulint> rseg_counter{0};
   ulong n_rollback_segments = srv_rollback_segments;
 
@@ -1221,8 +1241,14 @@ static trx_rseg_t *get_next_redo_rseg_from_trx_sys() {
   srv_rollback_segments is increased. */
   ut_ad(n_rollback_segments <= trx_sys->rsegs.size());
 
-  /* Try the next slot that no other thread is looking at */
-  ulint slot = (rseg_counter.fetch_add(1) + 1) % n_rollback_segments;
+  /* Keep the slot of the previous transaction, otherwise try the next
+  slot that no other thread is looking at */
+  ulint slot = trx->rseg_slot_hint;
+
+  if (slot >= n_rollback_segments) {
+    slot = (rseg_counter.fetch_add(1) + 1) % n_rollback_segments;
+    trx->rseg_slot_hint = slot;
+  }
 
   /* s_lock the vector since it might be sorted when added to. */
   trx_sys->rsegs.s_lock();
@@ -1240,12 +1266,13 @@ static trx_rseg_t *get_next_redo_rseg_from_trx_sys() {
 
 /** Get next redo rollback segment in round-robin fashion.
 We assume that the assigned slots are not contiguous and have gaps.
+@param[in,out]  trx     transaction to assign the rseg to
 @return assigned rollback segment instance */
-static trx_rseg_t *get_next_redo_rseg() {
+static trx_rseg_t *get_next_redo_rseg(trx_t *trx) {
   if (!trx_sys->rsegs.is_empty()) {
-    return (get_next_redo_rseg_from_trx_sys());
+    return (get_next_redo_rseg_from_trx_sys(trx));
   } else {
-    return (get_next_redo_rseg_from_undo_spaces());
+    return (get_next_redo_rseg_from_undo_spaces(trx));
   }
 }
 
@@ -1270,13 +1297,15 @@ static trx_rseg_t *get_next_temp_rseg() {
   return (rseg);
 }
 
-/** Assign a durable rollback segment to a transaction in a round-robin
-fashion.
+/** Assign a durable rollback segment to a transaction. The rseg of the
+previous transaction of the same trx object is preferred, otherwise the
+next one is taken in a round-robin fashion.
 @param[in,out]  trx     transaction that involves a durable write. */
 void trx_assign_rseg_durable(trx_t *trx) {
   ut_ad(trx->rsegs.m_redo.rseg == nullptr);
 
-  trx->rsegs.m_redo.rseg = srv_read_only_mode ? nullptr : get_next_redo_rseg();
+  trx->rsegs.m_redo.rseg =
+      srv_read_only_mode ? nullptr : get_next_redo_rseg(trx);
 }
 
 /** Assign an id for this RW transaction and insert it into trx_sys->rw_trx_ids
@@ -1298,6 +1327,8 @@ static void trx_assign_id_for_rw(trx_t *trx) {
     // The id is known to be greatest
     trx_sys->rw_trx_ids.push_back(trx->id);
   }
+
+  trx_sys->rw_trx_ids_version.fetch_add(1);
 }
 
 /** Assign a temp-tablespace bound rollback-segment to a transaction.
@@ -1511,8 +1542,19 @@ acquired trx_sys->serialisation_mutex prior to calling this function.
 static inline void trx_erase_from_serialisation_list_low(trx_t *trx) {
   ut_ad(trx_sys_serialisation_mutex_own());
 
+  const bool was_first = UT_LIST_GET_FIRST(trx_sys->serialisation_list) == trx;
+
   UT_LIST_REMOVE(trx_sys->serialisation_list, trx);
 
+  /* Commits do not complete in trx->no order. Unless the oldest serialised
+  transaction was removed, the minimum is unchanged and the (sequentially
+  consistent) store of it can be skipped while holding the mutex. */
+  if (!was_first) {
+    ut_ad(trx_sys->serialisation_min_trx_no.load() ==
+          UT_LIST_GET_FIRST(trx_sys->serialisation_list)->no);
+    return;
+  }
+
   if (UT_LIST_GET_LEN(trx_sys->serialisation_list) > 0) {
     trx_sys->serialisation_min_trx_no.store(
         UT_LIST_GET_FIRST(trx_sys->serialisation_list)->no);
@@ -1855,6 +1897,7 @@ static void trx_erase_lists(trx_t *trx) {
 
   ut_ad(*it == trx->id);
   trx_sys->rw_trx_ids.erase(it);
+  trx_sys->rw_trx_ids_version.fetch_add(1);
 
   if (trx->read_only || trx->rsegs.m_redo.rseg == nullptr) {
     ut_ad(!trx->in_rw_trx_list);
@@ -7637,6 +7637,17 @@ static size_t my_well_formed_len_utf8mb4(const CHARSET_INFO *cs, const char *b,
                                          int *error) {
   const char *b_start = b;
   *error = 0;
+
+  // Fast path as long as we see ASCII characters only.
+  while (pos >= sizeof(uint64_t) &&
+         static_cast<size_t>(e - b) >= sizeof(uint64_t)) {
+    uint64_t data;
+    memcpy(&data, b, sizeof(data));
+    if (data & 0x8080808080808080ULL) break;
+    b += sizeof(data);
+    pos -= sizeof(data);
+  }
+
   while (pos) {
     int mb_len;
 
@@ -22,13 +22,20 @@
 
 #include <gtest/gtest.h>
 #include <stddef.h>
+#include <string.h>
 #include <sys/types.h>
+#include <algorithm>
+#include <random>
 #include <utility>
+#include <vector>
 
+#include "my_byteorder.h"
 #include "my_inttypes.h"
 #include "my_pointer_arithmetic.h"
 #include "sql/filesort_utils.h"
+#include "sql/sort_param.h"
 #include "sql/table.h"
+#include "unittest/gunit/benchmark.h"
 
 namespace filesort_buffer_unittest {
 
@@ -162,4 +169,195 @@ TEST_F(FileSortBufferTest, PreallocateRecords) {
   }
 }
 
+/*
+  Fixture for Filesort_buffer::sort_buffer(). Every record holds a key of
+  key_len bytes followed by its sequence number, which plays the part of the
+  row reference and is not compared. Key bytes are drawn from a few values,
+  so many keys are equal and the stability of the sort is visible.
+*/
+class FileSortBufferSortTest : public FileSortBufferTest {
+ protected:
+  static constexpr size_t ref_length = 4;
+
+  void fill(size_t num_records, size_t key_len, uint distinct_bytes = 4) {
+    m_key_len = key_len;
+    m_num_records = num_records;
+    m_param.sum_ref_length = ref_length;
+    m_param.set_max_compare_length(key_len + ref_length);
+
+    std::mt19937 rng(static_cast<uint>(num_records * 31 + key_len));
+    std::uniform_int_distribution<uint> dist(0, distinct_bytes - 1);
+    const size_t record_length = key_len + ref_length;
+
+    fs_info.set_max_size(64 * 1024 * 1024, record_length);
+    for (size_t ix = 0; ix < num_records; ++ix) {
+      Bounds_checked_array<uchar> buf =
+          fs_info.get_next_record_pointer(record_length);
+      ASSERT_GE(buf.size(), record_length);
+      for (size_t byte = 0; byte < key_len; ++byte) {
+        // The first byte is constant, like the NULL indicator of a NOT NULL
+        // column; the others take the values 0x00, 0x01, ..., and 0xff.
+        const uint value = dist(rng);
+        buf[byte] =
+            byte == 0 ? 1 : (value == distinct_bytes - 1 ? 0xff : value);
+      }
+      int4store(buf.array() + key_len, static_cast<uint32>(ix));
+      fs_info.commit_used_memory(record_length);
+    }
+  }
+
+  /// The records in the order of a stable sort on their keys.
+  std::vector<uchar *> expected_order() {
+    uchar **keys = fs_info.get_sort_keys();
+    std::vector<uchar *> expected(keys, keys + m_num_records);
+    const size_t key_len = m_key_len;
+    std::stable_sort(expected.begin(), expected.end(),
+                     [key_len](const uchar *a, const uchar *b) {
+                       return memcmp(a, b, key_len) < 0;
+                     });
+    return expected;
+  }
+
+  /// Sort the buffer and check the result against std::stable_sort().
+  void sort_and_verify(Sort_param::enum_sort_algorithm algorithm) {
+    const std::vector<uchar *> expected = expected_order();
+
+    EXPECT_EQ(m_num_records, fs_info.sort_buffer(&m_param, m_num_records,
+                                                 m_num_records));
+    EXPECT_EQ(algorithm, m_param.m_sort_algorithm);
+
+    uchar **keys = fs_info.get_sort_keys();
+    const std::vector<uchar *> actual(keys, keys + m_num_records);
+    for (size_t ix = 0; ix < m_num_records; ++ix) {
+      ASSERT_EQ(expected[ix], actual[ix])
+          << "record " << ix << " of " << m_num_records << ", key length "
+          << m_key_len << ", original position " << uint4korr(actual[ix] +
+                                                              m_key_len);
+    }
+  }
+
+  Sort_param m_param;
+  size_t m_key_len{0};
+  size_t m_num_records{0};
+};
+
+/*
+  Short keys are radix sorted from 4096 records up, and sorted with
+  std::stable_sort() below that. Both must give the same order.
+*/
+TEST_F(FileSortBufferSortTest, ShortKeysAroundRadixThreshold) {
+  for (size_t num_records : {101, 4095}) {
+    fill(num_records, 4);
+    sort_and_verify(Sort_param::FILESORT_ALG_STD_STABLE);
+    fs_info.reset();
+  }
+  for (size_t num_records : {4096, 4097, 20000}) {
+    fill(num_records, 4);
+    sort_and_verify(Sort_param::FILESORT_ALG_RADIX);
+    fs_info.reset();
+  }
+}
+
+/*
+  Keys of one to nine bytes are radix sorted; ten bytes and more are not.
+*/
+TEST_F(FileSortBufferSortTest, RadixSortKeyLengths) {
+  for (size_t key_len : {1, 2, 8, 9}) {
+    fill(10000, key_len);
+    sort_and_verify(Sort_param::FILESORT_ALG_RADIX);
+    fs_info.reset();
+  }
+  fill(10000, 10);
+  sort_and_verify(Sort_param::FILESORT_ALG_STD_STABLE);
+}
+
+/*
+  With all keys equal, every pass of the radix sort is skipped and the
+  records must stay in their original order.
+*/
+TEST_F(FileSortBufferSortTest, RadixSortEqualKeysKeepOrder) {
+  fill(5000, 9, 1);
+  uchar **keys = fs_info.get_sort_keys();
+  const std::vector<uchar *> original(keys, keys + 5000);
+  sort_and_verify(Sort_param::FILESORT_ALG_RADIX);
+  EXPECT_TRUE(std::equal(original.begin(), original.end(),
+                         fs_info.get_sort_keys()));
+}
+
+/*
+  Few distinct byte values make long runs of equal keys, which a stable sort
+  must keep in their original order.
+*/
+TEST_F(FileSortBufferSortTest, RadixSortIsStable) {
+  fill(30000, 3, 2);
+  sort_and_verify(Sort_param::FILESORT_ALG_RADIX);
+}
+
+/*
+  Keys of ten bytes or more are sorted with parallel_stable_sort(). From
+  16384 records per thread up, the buffer is split in segments that are
+  sorted on helper threads and then merged pairwise. Three threads leave an
+  unpaired segment for the first round of merges.
+*/
+TEST_F(FileSortBufferSortTest, ParallelSort) {
+  for (uint threads : {2, 3, 4}) {
+    m_param.max_sort_threads = threads;
+    for (size_t key_len : {10, 16}) {
+      fill(threads * 16384 + 123, key_len);
+      sort_and_verify(Sort_param::FILESORT_ALG_STD_STABLE);
+      fs_info.reset();
+    }
+  }
+}
+
+#ifndef NDEBUG
+/*
+  When no helper thread can be reserved, the calling thread sorts and merges
+  every segment itself, which must give the same result.
+*/
+TEST_F(FileSortBufferSortTest, ParallelSortWithoutHelperThreads) {
+  DBUG_SET("+d,sort_helper_thread_unavailable");
+  for (uint threads : {2, 3, 4}) {
+    m_param.max_sort_threads = threads;
+    fill(threads * 16384 + 123, 12);
+    sort_and_verify(Sort_param::FILESORT_ALG_STD_STABLE);
+    fs_info.reset();
+  }
+  DBUG_SET("-d,sort_helper_thread_unavailable");
+}
+#endif
+
+/*
+  Microbenchmark for filling the sort buffer with small, fixed-size sort
+  keys, as done by filesort for every row read, and then reusing the buffer
+  for the next chunk.
+*/
+static void BM_FillSortBuffer(size_t num_iterations) {
+  StopBenchmarkTiming();
+
+  const size_t record_length = 16;
+  const size_t num_records = 10000;
+  uchar record[record_length];
+  memset(record, 'a', record_length);
+
+  Filesort_buffer fs_info;
+  fs_info.set_max_size(4 * 1024 * 1024, record_length);
+
+  StartBenchmarkTiming();
+  for (size_t i = 0; i < num_iterations; ++i) {
+    for (size_t ix = 0; ix < num_records; ++ix) {
+      Bounds_checked_array<uchar> buf =
+          fs_info.get_next_record_pointer(record_length);
+      memcpy(buf.array(), record, record_length);
+      fs_info.commit_used_memory(record_length);
+    }
+    fs_info.reset();
+  }
+  StopBenchmarkTiming();
+
+  fs_info.free_sort_buffer();
+  SetBytesProcessed(num_iterations * num_records * record_length);
+}
+BENCHMARK(BM_FillSortBuffer)
+
 }  // namespace filesort_buffer_unittest
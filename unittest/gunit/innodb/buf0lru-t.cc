@@ -0,0 +1,95 @@
+/* Copyright (c) 2023, Oracle and/or its affiliates.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License, version 2.0,
+   as published by the Free Software Foundation.
+
+   This program is also distributed with certain software (including
+   but not limited to OpenSSL) that is licensed under separate terms,
+   as designated in a particular file or component or in included license
+   documentation.  The authors of MySQL hereby grant you an additional
+   permission to link the program and your derivative works with the
+   separately licensed software that they have included with MySQL.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License, version 2.0, for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
+
+#include <gtest/gtest.h>
+
+#include "storage/innobase/include/buf0lru.h"
+#include "storage/innobase/include/buf0types.h"
+
+namespace innodb_buf0lru_unittest {
+
+TEST(buf0lru, ghost_list_remembers_evicted_pages) {
+  buf_LRU_ghost_t ghost;
+
+  ghost.insert(page_id_t{1, 10}, 4);
+  ghost.insert(page_id_t{1, 11}, 4);
+
+  EXPECT_EQ(2U, ghost.size());
+  EXPECT_TRUE(ghost.remove(page_id_t{1, 10}));
+  /* A hit consumes the entry. */
+  EXPECT_FALSE(ghost.remove(page_id_t{1, 10}));
+  EXPECT_FALSE(ghost.remove(page_id_t{2, 10}));
+  EXPECT_EQ(1U, ghost.size());
+}
+
+TEST(buf0lru, ghost_list_forgets_oldest_first) {
+  buf_LRU_ghost_t ghost;
+
+  for (page_no_t page_no = 0; page_no < 8; ++page_no) {
+    ghost.insert(page_id_t{5, page_no}, 4);
+  }
+
+  EXPECT_EQ(4U, ghost.size());
+
+  for (page_no_t page_no = 0; page_no < 4; ++page_no) {
+    EXPECT_FALSE(ghost.remove(page_id_t{5, page_no}));
+  }
+
+  for (page_no_t page_no = 4; page_no < 8; ++page_no) {
+    EXPECT_TRUE(ghost.remove(page_id_t{5, page_no}));
+  }
+}
+
+TEST(buf0lru, ghost_list_reinsert_refreshes_age) {
+  buf_LRU_ghost_t ghost;
+
+  ghost.insert(page_id_t{0, 1}, 2);
+  ghost.insert(page_id_t{0, 2}, 2);
+  /* Page 1 is evicted again, it is now the youngest entry. */
+  ghost.insert(page_id_t{0, 1}, 2);
+  ghost.insert(page_id_t{0, 3}, 2);
+
+  EXPECT_EQ(2U, ghost.size());
+  EXPECT_FALSE(ghost.remove(page_id_t{0, 2}));
+  EXPECT_TRUE(ghost.remove(page_id_t{0, 1}));
+  EXPECT_TRUE(ghost.remove(page_id_t{0, 3}));
+}
+
+TEST(buf0lru, ghost_list_trim_to_zero) {
+  buf_LRU_ghost_t ghost;
+
+  for (page_no_t page_no = 0; page_no < 100; ++page_no) {
+    ghost.insert(page_id_t{3, page_no}, 1000);
+    if (page_no % 2 == 0) {
+      EXPECT_TRUE(ghost.remove(page_id_t{3, page_no}));
+    }
+  }
+
+  EXPECT_EQ(50U, ghost.size());
+
+  ghost.trim(0);
+
+  EXPECT_EQ(0U, ghost.size());
+  EXPECT_FALSE(ghost.remove(page_id_t{3, 99}));
+}
+
+}  // namespace innodb_buf0lru_unittest
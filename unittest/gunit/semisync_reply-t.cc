@@ -0,0 +1,131 @@
+/* Copyright (c) 2023, Oracle and/or its affiliates.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License, version 2.0,
+   as published by the Free Software Foundation.
+
+   This program is also distributed with certain software (including
+   but not limited to OpenSSL) that is licensed under separate terms,
+   as designated in a particular file or component or in included license
+   documentation.  The authors of MySQL hereby grant you an additional
+   permission to link the program and your derivative works with the
+   separately licensed software that they have included with MySQL.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License, version 2.0, for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "plugin/semisync/semisync_reply.h"
+
+namespace semisync_reply_unittest {
+
+using Packet = std::vector<uchar>;
+
+/* Build a reply packet the way ReplSemiSyncSlave::slaveReply() does. */
+Packet make_reply(const std::string &name, my_off_t pos,
+                  uchar magic = SEMISYNC_PACKET_MAGIC_NUM) {
+  Packet packet(REPLY_BINLOG_NAME_OFFSET + name.size());
+  packet[REPLY_MAGIC_NUM_OFFSET] = magic;
+  int8store(packet.data() + REPLY_BINLOG_POS_OFFSET, pos);
+  memcpy(packet.data() + REPLY_BINLOG_NAME_OFFSET, name.data(), name.size());
+  return packet;
+}
+
+/* The pending ack of one batch, kept the way Ack_receiver::run() does. */
+struct Pending_ack {
+  char file_name[FN_REFLEN + 1];
+  my_off_t file_pos{0};
+  bool has_ack{false};
+
+  void read(const Packet &packet) {
+    if (decode_reply_packet(packet.data(), packet.size(), file_name,
+                            &file_pos) == Reply_packet_status::OK)
+      has_ack = true;
+  }
+};
+
+TEST(SemisyncReplyTest, DecodesValidReply) {
+  const Packet packet = make_reply("binlog.000001", 4711);
+  char name[FN_REFLEN + 1];
+  my_off_t pos = 0;
+
+  EXPECT_EQ(Reply_packet_status::OK,
+            decode_reply_packet(packet.data(), packet.size(), name, &pos));
+  EXPECT_STREQ("binlog.000001", name);
+  EXPECT_EQ(4711U, pos);
+}
+
+TEST(SemisyncReplyTest, RejectsMalformedReplies) {
+  char name[FN_REFLEN + 1];
+  my_off_t pos = 0;
+
+  Packet bad_magic = make_reply("binlog.000001", 1, 0x00);
+  EXPECT_EQ(Reply_packet_status::BAD_MAGIC_NUM,
+            decode_reply_packet(bad_magic.data(), bad_magic.size(), name,
+                                &pos));
+
+  Packet too_short = make_reply("", 1);
+  too_short.resize(REPLY_BINLOG_NAME_OFFSET - 1);
+  EXPECT_EQ(Reply_packet_status::TOO_SHORT,
+            decode_reply_packet(too_short.data(), too_short.size(), name,
+                                &pos));
+
+  Packet longest = make_reply(std::string(FN_REFLEN - 1, 'a'), 1);
+  EXPECT_EQ(Reply_packet_status::OK,
+            decode_reply_packet(longest.data(), longest.size(), name, &pos));
+
+  Packet too_long = make_reply(std::string(FN_REFLEN, 'a'), 1);
+  EXPECT_EQ(Reply_packet_status::NAME_TOO_LONG,
+            decode_reply_packet(too_long.data(), too_long.size(), name,
+                                &pos));
+}
+
+/*
+  Every kind of malformed reply that follows a valid one in the same batch
+  must leave the pending ack of the valid one intact, the name and the
+  position alike.
+*/
+TEST(SemisyncReplyTest, InvalidReplyKeepsPendingAck) {
+  Packet bad_magic = make_reply("binlog.000002", 999999, 0x00);
+  Packet too_short = make_reply("", 999999);
+  too_short.resize(REPLY_BINLOG_NAME_OFFSET - 1);
+  Packet too_long = make_reply(std::string(FN_REFLEN, 'b'), 999999);
+
+  for (const Packet *invalid : {&bad_magic, &too_short, &too_long}) {
+    Pending_ack ack;
+    ack.read(make_reply("binlog.000001", 120));
+    ack.read(*invalid);
+
+    EXPECT_TRUE(ack.has_ack);
+    EXPECT_STREQ("binlog.000001", ack.file_name);
+    EXPECT_EQ(120U, ack.file_pos);
+  }
+}
+
+TEST(SemisyncReplyTest, LastValidReplyOfBatchWins) {
+  Packet too_long = make_reply(std::string(FN_REFLEN, 'b'), 999999);
+
+  Pending_ack ack;
+  ack.read(too_long);
+  EXPECT_FALSE(ack.has_ack);
+
+  ack.read(make_reply("binlog.000001", 120));
+  ack.read(too_long);
+  ack.read(make_reply("binlog.000002", 4));
+  ack.read(too_long);
+
+  EXPECT_TRUE(ack.has_ack);
+  EXPECT_STREQ("binlog.000002", ack.file_name);
+  EXPECT_EQ(4U, ack.file_pos);
+}
+
+}  // namespace semisync_reply_unittest
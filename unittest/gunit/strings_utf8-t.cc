@@ -517,6 +517,36 @@ TEST_F(StringsUTF8mb4Test, MyWellFormedLenUtf8mb4) {
   ASSERT_EQ(1, error);
 }
 
+TEST_F(StringsUTF8mb4Test, MyWellFormedLenUtf8mb4Ascii) {
+  const char ascii_src[] = "abcdefghijklmnopqrstuvwxyz0123456789";
+  const size_t ascii_len = sizeof(ascii_src) - 1;
+  int error;
+
+  /* ASCII run longer than the character limit */
+  EXPECT_EQ(10U, system_charset_info->cset->well_formed_len(
+                     system_charset_info, ascii_src, ascii_src + ascii_len, 10,
+                     &error));
+  ASSERT_EQ(0, error);
+
+  /* ASCII run shorter than the character limit */
+  EXPECT_EQ(ascii_len, system_charset_info->cset->well_formed_len(
+                           system_charset_info, ascii_src,
+                           ascii_src + ascii_len, 100, &error));
+  ASSERT_EQ(0, error);
+
+  /* Multi-byte and invalid characters after a long ASCII prefix */
+  char mixed_src[32] = "0123456789abcdefghij\xc2\x80\xc1";
+  EXPECT_EQ(22U, system_charset_info->cset->well_formed_len(
+                     system_charset_info, mixed_src, mixed_src + 23, 100,
+                     &error));
+  ASSERT_EQ(1, error);
+  /* Multi-byte character cut by the end of the string */
+  EXPECT_EQ(20U, system_charset_info->cset->well_formed_len(
+                     system_charset_info, mixed_src, mixed_src + 21, 100,
+                     &error));
+  ASSERT_EQ(1, error);
+}
+
 TEST_F(StringsUTF8mb4Test, MyIsmbcharUtf8mb4) {
   char utf8_src[8] = {0};
 